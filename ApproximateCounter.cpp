@@ -0,0 +1,169 @@
+/** ***************************************************************************
+ * @file:   ApproximateCounter.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  ApproximateCounter. For languages whose transfer matrix is not
+ *  primitive the normalized vector may cycle instead of converging; the
+ *  counter then keeps MAX_STEPS exact steps and extrapolates with the
+ *  average growth over the last of them.
+ *
+ *****************************************************************************/
+
+#include "ApproximateCounter.hpp"
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+// largest change of a normalized entry between steps at which the vector
+// counts as converged; the entries are at most 1, so a few units in the
+// last place of a long double, whatever its width on the platform
+static const long double TOLERANCE = 16 * std::numeric_limits<long double>::epsilon();
+
+// steps over which the average growth is taken when there is no convergence
+static const int AVERAGE_STEPS = 1000;
+
+
+/** ***************************************************************************
+ * @param  digits: number of significant digits, at least 1
+ * @return the estimate as text, e.g. "4.22713e+180"
+ *
+ *****************************************************************************/
+std::string Estimate::to_string(int digits) const {
+    if (mantissa == 0)
+        return "0";
+    std::ostringstream out;
+    out.precision(digits > 1 ? digits - 1 : 0);
+    out << std::fixed << mantissa << "e+" << exponent;
+    return out.str();
+}
+
+
+/** ***************************************************************************
+ * ApproximateCounter constructor - run the normalized DP until it converges
+ * @param  dfa: the DFA M
+ *
+ *****************************************************************************/
+template<typename T>
+ApproximateCounter::ApproximateCounter(const DFA<T> &dfa)
+    : delta(TransitionTable(dfa).minimized()), symbols(dfa.table_width() - 1),
+      logRate(0), converged(false) {
+    const int states = delta.states();
+    const int start = delta.start();
+    std::vector<long double> previous(states), current(states);
+    for (int q = 0; q < states; q++)
+        current[q] = delta.accepting(q) ? 1 : 0;
+
+    // current holds count(q, k) / 10^scale
+    long double scale = 0;
+    logCount.push_back(current[start] > 0 ? std::log10(current[start])
+                                          : -std::numeric_limits<long double>::infinity());
+    for (int k = 1; k <= MAX_STEPS && !converged; k++) {
+        previous.swap(current);
+        long double largest = 0;
+        for (int q = 0; q < states; q++) {
+            long double sum = 0;
+            for (int s = 0; s < symbols; s++)
+                sum += previous[delta.next(q, s)];
+            current[q] = sum;
+            if (sum > largest)
+                largest = sum;
+        }
+        if (largest == 0) {
+            // nothing is accepted from here on
+            logCount.push_back(-std::numeric_limits<long double>::infinity());
+            logRate = -std::numeric_limits<long double>::infinity();
+            converged = true;
+            break;
+        }
+
+        long double change = 0;
+        for (int q = 0; q < states; q++) {
+            current[q] /= largest;
+            change = std::fmax(change, std::fabs(current[q] - previous[q]));
+        }
+        scale += std::log10(largest);
+        logCount.push_back(current[start] > 0 ? scale + std::log10(current[start])
+                                              : -std::numeric_limits<long double>::infinity());
+        if (change < TOLERANCE) {
+            logRate = std::log10(largest);
+            converged = true;
+        }
+    }
+
+    if (!converged) {
+        int last = int(logCount.size()) - 1;
+        logRate = (logCount[last] - logCount[last - AVERAGE_STEPS]) / AVERAGE_STEPS;
+    }
+}
+
+
+/** ***************************************************************************
+ * @param  n: the length, n >= 0
+ * @return log10 of the number of strings of length n accepted by M,
+ *  -infinity if there are none
+ *
+ *****************************************************************************/
+long double ApproximateCounter::log10_count(int64_t n) const {
+    if (n < 0)
+        throw std::invalid_argument("ApproximateCounter: negative length");
+    int64_t last = int64_t(logCount.size()) - 1;
+    if (n <= last)
+        return logCount[n];
+    if (std::isinf(logRate) || std::isinf(logCount[last]))
+        return -std::numeric_limits<long double>::infinity();
+    return logCount[last] + (n - last) * logRate;
+}
+
+
+/** ***************************************************************************
+ * @param  n: the length, n >= 0
+ * @return the number of strings of length n accepted by M, approximately;
+ *  the leading digits get less precise as n grows past about 10^12, when
+ *  the exponent takes up most of the precision of a long double
+ *
+ *****************************************************************************/
+Estimate ApproximateCounter::count(int64_t n) const {
+    long double logarithm = log10_count(n);
+    if (std::isinf(logarithm))
+        return Estimate{0, 0};
+    long double exponent = std::floor(logarithm);
+    long double mantissa = std::pow(10.0L, logarithm - exponent);
+    // rounding may give 10 for a fraction just below 1
+    if (mantissa >= 10) {
+        mantissa /= 10;
+        exponent += 1;
+    }
+    return Estimate{mantissa, int64_t(exponent)};
+}
+
+
+/** ***************************************************************************
+ * @return the dominant eigenvalue λ of the transfer matrix, the factor by
+ *  which the count grows per symbol for large n
+ *
+ *****************************************************************************/
+long double ApproximateCounter::growth_rate() const {
+    return std::pow(10.0L, logRate);
+}
+
+
+/** ***************************************************************************
+ * @param  n: the length, n >= 0
+ * @return the exact number of strings of length n accepted by M; the
+ *  counts are kept for later calls
+ *
+ *****************************************************************************/
+BigUnsigned ApproximateCounter::exact(int n) {
+    if (n < 0)
+        throw std::invalid_argument("ApproximateCounter: negative length");
+    if (!exactCounts)
+        exactCounts.reset(new CountTable<BigUnsigned>(delta, symbols));
+    exactCounts->extend(n);
+    return exactCounts->row(n)[delta.start()];
+}
+
+template ApproximateCounter::ApproximateCounter(const DFA<char> &dfa);
+template ApproximateCounter::ApproximateCounter(const DFA<unsigned char> &dfa);
+template ApproximateCounter::ApproximateCounter(const DFA<char32_t> &dfa);
@@ -0,0 +1,70 @@
+/** ***************************************************************************
+ * @file:   ApproximateCounter.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called
+ *  ApproximateCounter
+ * @remark: An ApproximateCounter gives the magnitude and the leading digits
+ *  of the number of strings of length n accepted by M, for any n, without
+ *  big integers. It runs the counting DP over the minimized δ in long
+ *  double and divides the vector by its largest entry after every step,
+ *  adding the decimal logarithm of that factor to an exponent. The
+ *  normalized vector converges to the dominant eigenvector of the transfer
+ *  matrix (this is power iteration) and the factor to the dominant
+ *  eigenvalue λ, the growth rate of the count. Once they have converged,
+ *  count(n) = count(k) λ^(n - k) for every larger n, so any n costs O(1)
+ *  after a one-time run of a few hundred steps.
+ *
+ *  Exact counts are computed only when asked for, with BigUnsigned.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_APPROXIMATECOUNTER_HPP
+#define INC_454_P1_APPROXIMATECOUNTER_HPP
+
+
+#include "DFA.hpp"
+#include "CountTable.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// a positive number mantissa * 10^exponent with 1 <= mantissa < 10, or 0
+// with mantissa 0
+struct Estimate {
+    long double mantissa;
+    int64_t exponent;
+
+    std::string to_string(int digits = 6) const;
+};
+
+class ApproximateCounter {
+public:
+    template<typename T>
+    explicit ApproximateCounter(const DFA<T> &dfa);
+    Estimate count(int64_t n) const;
+    long double log10_count(int64_t n) const;
+    long double growth_rate() const;
+    BigUnsigned exact(int n);
+
+private:
+    // the steps of the DP are stopped after this many steps, converged or
+    // not
+    static constexpr int MAX_STEPS = 100000;
+
+    TransitionTable delta;
+    int symbols;
+
+    // log10 count(k) for k = 0 .. steps; -infinity for a count of 0
+    std::vector<long double> logCount;
+
+    // log10 of the growth rate, valid past the last step when converged
+    long double logRate;
+    bool converged;
+
+    std::unique_ptr<CountTable<BigUnsigned>> exactCounts;
+};
+
+
+#endif //INC_454_P1_APPROXIMATECOUNTER_HPP
@@ -0,0 +1,144 @@
+/** ***************************************************************************
+ * @file:   BatchMatcher.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  BatchMatcher. Both forms of match share one lane loop; they differ only
+ *  in how the i-th string is found. The lanes are independent scalar
+ *  chains rather than vector gathers: a gather per table level costs more
+ *  than the latency it hides for a table this small.
+ *
+ *****************************************************************************/
+
+#include "BatchMatcher.hpp"
+#include <cstring> // for std::memset
+
+namespace {
+
+// the strings of a contiguous buffer delimited by an offsets array
+template<typename T>
+struct OffsetSource {
+    const T *buffer;
+    const size_t *offsets;
+    const T *begin(size_t i) const { return buffer + offsets[i]; }
+    const T *end(size_t i) const { return buffer + offsets[i + 1]; }
+};
+
+// the strings of a vector of views
+template<typename T>
+struct ViewSource {
+    const std::vector<typename DFA<T>::View> &strings;
+    const T *begin(size_t i) const { return strings[i].data(); }
+    const T *end(size_t i) const { return strings[i].data() + strings[i].size(); }
+};
+
+}
+
+
+/** ***************************************************************************
+ * BatchMatcher constructor
+ * @param  dfa: the DFA M to run, must outlive the matcher
+ *
+ *****************************************************************************/
+template<typename T>
+BatchMatcher<T>::BatchMatcher(const DFA<T> &dfa) : dfa(dfa) {
+    const int width = dfa.table_width();
+    rows.assign(dfa.transition_table(),
+                dfa.transition_table() + DFA<T>::STATES * width);
+    for (int &target : rows)
+        target *= width;
+}
+
+
+/** ***************************************************************************
+ * decide membership for the strings of a contiguous buffer
+ * @param  buffer: the symbols of all strings
+ * @param  offsets: count + 1 offsets, string i is
+ *         buffer[offsets[i]] .. buffer[offsets[i + 1] - 1]
+ * @param  count: number of strings
+ * @param  accepted: a bitmap of at least (count + 7) / 8 bytes
+ * @post   bit i of accepted is set if M accepts string i, clear otherwise
+ *
+ *****************************************************************************/
+template<typename T>
+void BatchMatcher<T>::match(const T *buffer, const size_t *offsets,
+                            size_t count, uint8_t *accepted) const {
+    run(OffsetSource<T>{buffer, offsets}, count, accepted);
+}
+
+
+/** ***************************************************************************
+ * decide membership for a vector of strings
+ * @param  strings: views of the strings
+ * @param  accepted: a bitmap of at least (strings.size() + 7) / 8 bytes
+ * @post   bit i of accepted is set if M accepts strings[i], clear otherwise
+ *
+ *****************************************************************************/
+template<typename T>
+void BatchMatcher<T>::match(const std::vector<View> &strings,
+                            uint8_t *accepted) const {
+    run(ViewSource<T>{strings}, strings.size(), accepted);
+}
+
+
+/** ***************************************************************************
+ * run a batch of strings through M, LANES strings at a time
+ * @param  source: gives the begin and end of string i
+ * @param  count: number of strings
+ * @param  accepted: the bitmap to fill
+ *
+ *****************************************************************************/
+template<typename T>
+template<typename Source>
+void BatchMatcher<T>::run(const Source &source, size_t count,
+                          uint8_t *accepted) const {
+    struct Lane {
+        const T *pos;
+        const T *end;
+        int q;
+        size_t index;
+    };
+
+    const int *table = rows.data();
+    const int dead = DFA<T>::DEAD * dfa.table_width();
+    std::memset(accepted, 0, (count + 7) / 8);
+
+    Lane lanes[LANES];
+    int active = 0;
+    size_t next = 0;
+    for (; active < LANES && next < count; active++, next++)
+        lanes[active] = Lane{source.begin(next), source.end(next), 0, next};
+
+    while (active > 0) {
+        // one symbol for every lane; the lanes do not depend on each other
+        for (int l = 0; l < active; l++) {
+            Lane &lane = lanes[l];
+            if (lane.pos != lane.end)
+                lane.q = table[lane.q + dfa.symbol_class(*lane.pos++)];
+        }
+
+        // retire finished lanes and refill them from the batch
+        for (int l = 0; l < active; ) {
+            Lane &lane = lanes[l];
+            if (lane.pos != lane.end && lane.q != dead) {
+                l++;
+                continue;
+            }
+            if (lane.q != dead)
+                accepted[lane.index / 8] |= uint8_t(1u << (lane.index % 8));
+
+            if (next < count) {
+                lane = Lane{source.begin(next), source.end(next), 0, next};
+                next++;
+                l++;
+            }
+            else {
+                lane = lanes[--active];
+            }
+        }
+    }
+}
+
+template class BatchMatcher<char>;
+template class BatchMatcher<unsigned char>;
+template class BatchMatcher<char32_t>;
@@ -0,0 +1,48 @@
+/** ***************************************************************************
+ * @file:   BatchMatcher.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called BatchMatcher
+ * @remark: A BatchMatcher decides membership in L for many short strings at
+ *  once. Running one string at a time through δ is bound by the latency of
+ *  each table lookup, since every step needs the result of the one before
+ *  it. The batch matcher keeps LANES strings in flight and advances all of
+ *  them one symbol per round, so the lookups of different strings overlap;
+ *  a lane that finishes its string takes the next one from the batch. The
+ *  answers go into a caller-owned bitmap, bit i % 8 of byte i / 8 for
+ *  string i.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_BATCHMATCHER_HPP
+#define INC_454_P1_BATCHMATCHER_HPP
+
+
+#include "DFA.hpp"
+#include <cstdint>
+#include <vector>
+
+template<typename T>
+class BatchMatcher {
+public:
+    static constexpr int LANES = 16;
+    typedef typename DFA<T>::View View;
+
+    explicit BatchMatcher(const DFA<T> &dfa);
+    void match(const T *buffer, const size_t *offsets, size_t count,
+               uint8_t *accepted) const;
+    void match(const std::vector<View> &strings,
+               uint8_t *accepted) const;
+
+private:
+    template<typename Source>
+    void run(const Source &source, size_t count, uint8_t *accepted) const;
+
+    const DFA<T> &dfa;
+
+    // δ with every target state q replaced by q * dfa.table_width()
+    std::vector<int> rows;
+};
+
+
+#endif //INC_454_P1_BATCHMATCHER_HPP
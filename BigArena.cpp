@@ -0,0 +1,137 @@
+/** ***************************************************************************
+ * @file:   BigArena.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called BigArena
+ *  Storage is carved from the newest block by bumping a pointer. Requests
+ *  larger than a block get a block of their own. Nothing is freed before
+ *  reset() or the destructor.
+ *
+ *****************************************************************************/
+
+#include "BigArena.hpp"
+
+thread_local BigArena *BigArena::active = nullptr;
+
+
+/** ***************************************************************************
+ * BigArena constructor - create an empty arena
+ * @param  blockSize: size in bytes of the blocks storage is carved from
+ *
+ *****************************************************************************/
+BigArena::BigArena(size_t blockSize) : blockSize(blockSize ? blockSize : 1),
+    next(nullptr), remaining(0), allocationCount(0), bytesAllocated(0),
+    bytesReserved(0) { }
+
+
+/** ***************************************************************************
+ * BigArena destructor - release every block
+ *
+ *****************************************************************************/
+BigArena::~BigArena() {
+    reset();
+}
+
+
+/** ***************************************************************************
+ * carve storage from the arena
+ * @param  bytes: number of bytes needed
+ * @post   return storage that stays valid until the next reset
+ *
+ *****************************************************************************/
+unsigned char *BigArena::allocate(size_t bytes) {
+    allocationCount++;
+    bytesAllocated += bytes;
+
+    if (bytes > remaining) {
+        // an oversized request gets its own block, so the current block
+        // keeps serving the small ones
+        if (bytes > blockSize / 4) {
+            unsigned char *block = new unsigned char [bytes];
+            blocks.push_back(block);
+            bytesReserved += bytes;
+            return block;
+        }
+        next = new unsigned char [blockSize];
+        blocks.push_back(next);
+        bytesReserved += blockSize;
+        remaining = blockSize;
+    }
+
+    unsigned char *storage = next;
+    next += bytes;
+    remaining -= bytes;
+    return storage;
+}
+
+
+/** ***************************************************************************
+ * release all storage handed out by the arena in one step
+ * @post   the arena is empty and its statistics are cleared
+ *
+ *****************************************************************************/
+void BigArena::reset() {
+    for (unsigned char *block : blocks)
+        delete [] block;
+    blocks.clear();
+    next = nullptr;
+    remaining = 0;
+    allocationCount = 0;
+    bytesAllocated = 0;
+    bytesReserved = 0;
+}
+
+
+/** ***************************************************************************
+ * @return the number of allocations served since the last reset
+ *
+ *****************************************************************************/
+size_t BigArena::allocations() const {
+    return allocationCount;
+}
+
+
+/** ***************************************************************************
+ * @return the number of bytes handed out since the last reset
+ *
+ *****************************************************************************/
+size_t BigArena::bytes_allocated() const {
+    return bytesAllocated;
+}
+
+
+/** ***************************************************************************
+ * @return the number of bytes held in blocks
+ *
+ *****************************************************************************/
+size_t BigArena::bytes_reserved() const {
+    return bytesReserved;
+}
+
+
+/** ***************************************************************************
+ * @return the arena active on this thread, or nullptr for the heap
+ *
+ *****************************************************************************/
+BigArena *BigArena::current() {
+    return active;
+}
+
+
+/** ***************************************************************************
+ * Scope constructor - make an arena active on this thread
+ * @param  arena: the arena to use, or nullptr to use the heap
+ *
+ *****************************************************************************/
+BigArena::Scope::Scope(BigArena *arena) : previous(active) {
+    active = arena;
+}
+
+
+/** ***************************************************************************
+ * Scope destructor - restore the arena that was active before
+ *
+ *****************************************************************************/
+BigArena::Scope::~Scope() {
+    active = previous;
+}
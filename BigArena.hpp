@@ -0,0 +1,68 @@
+/** ***************************************************************************
+ * @file:   BigArena.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called BigArena
+ * @remark: A BigArena hands out digit storage for BigUnsigned objects from
+ *  large blocks and gives all of it back at once when it is reset or
+ *  destroyed, instead of one new[]/delete[] pair per value. An arena is
+ *  made active for the current thread with a BigArena::Scope; while it is,
+ *  every BigUnsigned that allocates takes its digits from the arena.
+ *  Without an active arena BigUnsigned uses the heap as before.
+ *
+ *  A BigUnsigned whose digits live in an arena must not outlive the
+ *  arena's next reset.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_BIGARENA_HPP
+#define INC_454_P1_BIGARENA_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+class BigArena {
+public:
+    explicit BigArena(size_t blockSize = 1 << 20);
+    ~BigArena();
+    BigArena(const BigArena &other) = delete;
+    BigArena &operator = (const BigArena &other) = delete;
+
+    unsigned char *allocate(size_t bytes);
+    void reset();
+
+    size_t allocations() const;
+    size_t bytes_allocated() const;
+    size_t bytes_reserved() const;
+
+    static BigArena *current();
+
+    // makes an arena (or the heap, for nullptr) active until destroyed
+    class Scope {
+    public:
+        explicit Scope(BigArena *arena);
+        ~Scope();
+        Scope(const Scope &other) = delete;
+        Scope &operator = (const Scope &other) = delete;
+    private:
+        BigArena *previous;
+    };
+
+private:
+    size_t blockSize;
+    std::vector<unsigned char *> blocks;
+
+    // free bytes at the end of the newest block
+    unsigned char *next;
+    size_t remaining;
+
+    size_t allocationCount;
+    size_t bytesAllocated;
+    size_t bytesReserved;
+
+    static thread_local BigArena *active;
+};
+
+
+#endif //INC_454_P1_BIGARENA_HPP
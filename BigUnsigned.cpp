@@ -13,7 +13,9 @@
 
 #include "BigUnsigned.hpp"
 #include <sstream>
+#include <stdexcept>
 #include <string> // for operator * overload
+#include <string_view>
 #include <vector> // for operator * overload
 
 
@@ -28,8 +30,9 @@
  *****************************************************************************/
 
 BigUnsigned::BigUnsigned() {
-    size = 1;
-    value = new unsigned char[size];
+    size = capacity = 1;
+    arena = BigArena::current();
+    value = allocate(size, arena);
     value[0] = 0;
 }
 
@@ -45,7 +48,38 @@ BigUnsigned::BigUnsigned() {
  *****************************************************************************/
 
 BigUnsigned::~BigUnsigned() {
-    delete [] value;
+    release(value, arena);
+}
+
+/** ***************************************************************************
+ *
+ * Function name: allocate
+ * Input parameters: A number of digits and the arena to take them from.
+ * Returned result: A digit array.
+ * Description: This function will allocate a digit array from the arena,
+ *		or from the heap when the arena is nullptr.
+ *
+ *****************************************************************************/
+
+unsigned char *BigUnsigned::allocate(size_t count, BigArena *arena) {
+    if (arena != nullptr)
+        return arena->allocate(count);
+    return new unsigned char [count];
+}
+
+/** ***************************************************************************
+ *
+ * Function name: release
+ * Input parameters: A digit array and the arena it was taken from.
+ * Returned result: None
+ * Description: This function will free a digit array allocated from the
+ *		heap. Arena storage is left to be freed with its arena.
+ *
+ *****************************************************************************/
+
+void BigUnsigned::release(unsigned char *digits, BigArena *arena) {
+    if (arena == nullptr)
+        delete [] digits;
 }
 
 /** ***************************************************************************
@@ -60,8 +94,9 @@ BigUnsigned::~BigUnsigned() {
  *****************************************************************************/
 
 BigUnsigned::BigUnsigned(const BigUnsigned &other) {
-    size = other.size;
-    value = new unsigned char [size];
+    size = capacity = other.size;
+    arena = BigArena::current();
+    value = allocate(size, arena);
     for (int i = 0; i < size; i++)
         value[i] = other.value[i];
 }
@@ -69,37 +104,47 @@ BigUnsigned::BigUnsigned(const BigUnsigned &other) {
 /** ***************************************************************************
  *
  * Function name: BigUnsigned
- * Input parameters: A string containing an unsigned nummeric value.
+ * Input parameters: A view of a string containing an unsigned nummeric value.
  * Returned result: None
  * Description: This is an additional constructor that will initialize a new
  *		BigUnsigned object by converting a string parmeter to a
- *		BigUnsigned value.
+ *		BigUnsigned value. The digits are read straight out of the
+ *		view (which may point into a std::string, a file buffer or a
+ *		memory mapping), so no temporary strings are built. Since a
+ *		value keeps one decimal digit per element, every digit is
+ *		placed directly and the conversion is linear in the length of
+ *		the input.
  *
  *****************************************************************************/
 
-BigUnsigned::BigUnsigned(const std::string &str) {
-    std::string temp;
-    int i = 0;
+BigUnsigned::BigUnsigned(std::string_view str) {
+    size_t i = 0;
     // ignore leading white space
-    while (isspace (str[i]))
+    while (i < str.size() && isspace (static_cast<unsigned char>(str[i])))
         i++;
     // ignore leading zeros
-    while (str[i] == '0')
+    while (i < str.size() && str[i] == '0')
         i++;
-    // collect digits from the input string
-    while (isdigit (str[i]))
-        temp += str[i++];
-    // if not digits have been collected set the string to "0"
-    if (temp.length() == 0)
-        temp = "0";
+    // find the end of the run of digits
+    size_t end = i;
+    while (end < str.size() && isdigit (static_cast<unsigned char>(str[end])))
+        end++;
+    // if no digits have been found the value is 0
+    if (end == i) {
+        size = capacity = 1;
+        arena = BigArena::current();
+        value = allocate(size, arena);
+        value[0] = 0;
+        return;
+    }
     // determine the number of digits in the string
-    size = temp.length();
+    size = capacity = end - i;
     // create a dynamic arry to hold the object's value
-    value = new unsigned char [size];
-    // copy the digits from the string to the dynamic array.
-    int j = 0;
-    for (int i = temp.length()-1; i >= 0; i--)
-        value[j++] = temp[i] - '0';
+    arena = BigArena::current();
+    value = allocate(size, arena);
+    // copy the digits from the view to the dynamic array.
+    for (size_t j = 0; j < size; j++)
+        value[j] = str[end - 1 - j] - '0';
 }
 
 /** ***************************************************************************
@@ -130,9 +175,15 @@ size_t BigUnsigned::length() const {
 BigUnsigned &BigUnsigned::operator = (const BigUnsigned &other) {
     if (this == & other)
         return * this;
+    // keep the current array when it is already large enough and comes
+    // from the storage that is active now
+    if (capacity < other.size || arena != BigArena::current()) {
+        release(value, arena);
+        capacity = other.size;
+        arena = BigArena::current();
+        this->value = allocate(capacity, arena);
+    }
     size = other.size;
-    delete [] value;
-    this->value = new unsigned char [size];
     for (int i = 0; i < size; i++)
         value[i] = other.value[i];
     return * this;
@@ -153,9 +204,9 @@ BigUnsigned &BigUnsigned::operator = (const BigUnsigned &other) {
 
 BigUnsigned BigUnsigned::operator + (const BigUnsigned &other) const {
     BigUnsigned sum;
-    delete [] sum.value;
-    sum.size = (size > other.size ? size : other.size);
-    sum.value = new unsigned char [sum.size];
+    release(sum.value, sum.arena);
+    sum.size = sum.capacity = (size > other.size ? size : other.size);
+    sum.value = allocate(sum.size, sum.arena);
     int carry = 0;
     int p = 0;
     while (p < size && p < other.size) {
@@ -181,9 +232,10 @@ BigUnsigned BigUnsigned::operator + (const BigUnsigned &other) const {
 
     if (carry != 0) {
         BigUnsigned temp = sum;
-        delete [] sum.value;
+        release(sum.value, sum.arena);
         sum.size++;
-        sum.value = new unsigned char [sum.size];
+        sum.capacity = sum.size;
+        sum.value = allocate(sum.size, sum.arena);
         for (int i = 0; i < sum.size - 1; i++)
             sum.value[i] = temp.value[i];
         sum.value[sum.size - 1] = carry;
@@ -227,24 +279,58 @@ std::ostream &operator << (std::ostream &outs, const BigUnsigned &BU) {
  *****************************************************************************/
 
 std::istream &operator >> (std::istream &ins, BigUnsigned &BU) {
-    std::string value;
+    std::istream::sentry sentry(ins);
+    if (!sentry)
+        return ins;
+
+    // digits are pulled straight from the stream buffer into a growing
+    // digit array that is handed over to BU, most significant digit first
+    std::streambuf *buf = ins.rdbuf();
+    const int eof = std::char_traits<char>::eof();
     bool zeroFound = false;
-    while (isspace (ins.peek()))
-        ins.get();
-    while (ins.peek() == '0') {
-        ins.get();
+    int c = buf->sgetc();
+    while (c == '0') {
         zeroFound = true;
+        c = buf->snextc();
     }
-    while (isdigit (ins.peek())) {
-        char c = ins.get();
-        value += c;
+
+    BigArena *arena = BigArena::current();
+    size_t capacity = 64;
+    size_t count = 0;
+    unsigned char *digits = BigUnsigned::allocate(capacity, arena);
+    while (c != eof && isdigit (c)) {
+        if (count == capacity) {
+            unsigned char *grown = BigUnsigned::allocate(capacity * 2, arena);
+            for (size_t i = 0; i < count; i++)
+                grown[i] = digits[i];
+            BigUnsigned::release(digits, arena);
+            digits = grown;
+            capacity *= 2;
+        }
+        digits[count++] = c - '0';
+        c = buf->snextc();
     }
-    if (value.length() == 0) {
-        value = "0";
+    if (c == eof)
+        ins.setstate (std::ios::eofbit);
+
+    if (count == 0) {
+        digits[count++] = 0;
         if (!zeroFound)
             ins.setstate (std::ios::failbit);
     }
-    BU = BigUnsigned (value);
+
+    // store little-endian
+    for (size_t i = 0, j = count - 1; i < j; i++, j--) {
+        unsigned char t = digits[i];
+        digits[i] = digits[j];
+        digits[j] = t;
+    }
+
+    BigUnsigned::release(BU.value, BU.arena);
+    BU.value = digits;
+    BU.size = count;
+    BU.capacity = capacity;
+    BU.arena = arena;
     return ins;
 }
 
@@ -260,8 +346,9 @@ std::istream &operator >> (std::istream &ins, BigUnsigned &BU) {
 
 BigUnsigned::BigUnsigned (unsigned V) {
     std::string str = std::to_string(V);
-    size = str.size();
-    value = new unsigned char[size];
+    size = capacity = str.size();
+    arena = BigArena::current();
+    value = allocate(size, arena);
     int j = size - 1;
     for (int i = 0; i < size; i++) {
         value[j] = str[i] - '0';
@@ -320,6 +407,32 @@ bool BigUnsigned::operator < (const BigUnsigned &other) const {
     return false;
 }
 
+/** ***************************************************************************
+ *
+ * Function name: operator !=, <=, >, >=
+ * Input parameters: BigUnsigned object to be compared with.
+ * Returned result: True or false.
+ * Description: The remaining comparison operators, written in terms of
+ *              == and <.
+ *
+ *****************************************************************************/
+
+bool BigUnsigned::operator != (const BigUnsigned &other) const {
+    return !(*this == other);
+}
+
+bool BigUnsigned::operator <= (const BigUnsigned &other) const {
+    return !(other < *this);
+}
+
+bool BigUnsigned::operator > (const BigUnsigned &other) const {
+    return other < *this;
+}
+
+bool BigUnsigned::operator >= (const BigUnsigned &other) const {
+    return !(*this < other);
+}
+
 /** ***************************************************************************
  *
  * Function name: operator +=
@@ -330,12 +443,267 @@ bool BigUnsigned::operator < (const BigUnsigned &other) const {
  *
  *****************************************************************************/
 
-BigUnsigned BigUnsigned::operator += (const BigUnsigned &other) {
-    BigUnsigned temp = *this + other;
-    *this = temp;
+BigUnsigned &BigUnsigned::operator += (const BigUnsigned &other) {
+    const BigUnsigned *terms[2] = {this, &other};
+    add_all(*this, terms, 2);
     return *this;
 }
 
+/** ***************************************************************************
+ *
+ * Function name: operator -
+ * Input parameters: BigUnsigned object to be subtracted, not larger than
+ *              the object on the left.
+ * Returned result: A BigUnsigned object that is the difference.
+ * Description: This is the subtraction operation. It subtracts the object
+ *              on the right from the object on the left and returns a new
+ *              BigUnsigned object. It throws std::underflow_error when the
+ *              difference would be negative.
+ *
+ *****************************************************************************/
+
+BigUnsigned BigUnsigned::operator - (const BigUnsigned &other) const {
+    BigUnsigned difference = *this;
+    difference -= other;
+    return difference;
+}
+
+/** ***************************************************************************
+ *
+ * Function name: operator -=
+ * Input parameters: BigUnsigned object to be subtracted, not larger than
+ *              the object on the left.
+ * Returned result: The object will be modified.
+ * Description: This is the -= operator. It subtracts digit by digit with
+ *              a borrow, in place, since the difference never needs more
+ *              digits than the object on the left has, and then drops the
+ *              leading zeros. It throws std::underflow_error when the
+ *              difference would be negative.
+ *
+ *****************************************************************************/
+
+BigUnsigned &BigUnsigned::operator -= (const BigUnsigned &other) {
+    if (*this < other)
+        throw std::underflow_error("BigUnsigned: negative difference");
+
+    int borrow = 0;
+    for (size_t p = 0; p < size; p++) {
+        int d = value[p] - borrow - (p < other.size ? other.value[p] : 0);
+        borrow = d < 0;
+        value[p] = d + 10 * borrow;
+        if (p >= other.size && borrow == 0)
+            break;
+    }
+
+    while (size > 1 && value[size - 1] == 0)
+        size--;
+    return *this;
+}
+
+/** ***************************************************************************
+ *
+ * Function name: add_all
+ * Input parameters: The BigUnsigned object that receives the sum, an array
+ *              of pointers to the operands and the number of operands.
+ * Returned result: None
+ * Description: This is a multi-operand addition. Instead of resolving the
+ *              carries of every partial sum as chained += would, each
+ *              column of digits is summed across all operands and the
+ *              carry is propagated once per column, in a single pass from
+ *              the least significant digit up. The digit array of sum is
+ *              reused when it is large enough and was taken from the
+ *              storage active now, and sum may itself be one of the
+ *              operands.
+ *
+ *****************************************************************************/
+
+void BigUnsigned::add_all(BigUnsigned &sum, const BigUnsigned *const *terms,
+                          size_t count) {
+    size_t width = 0;
+    for (size_t k = 0; k < count; k++)
+        if (terms[k]->size > width)
+            width = terms[k]->size;
+
+    // the carry out of the top column is below count, so the result
+    // needs at most as many extra digits as count has
+    size_t extra = 1;
+    for (size_t c = count; c >= 10; c /= 10)
+        extra++;
+
+    // write into a fresh array when the current one is too small; it is
+    // only released at the end because sum may be one of the operands
+    unsigned char *digits = sum.value;
+    BigArena *arena = sum.arena;
+    if (sum.capacity < width + extra || arena != BigArena::current()) {
+        arena = BigArena::current();
+        digits = allocate(width + extra, arena);
+    }
+
+    unsigned long carry = 0;
+    size_t p = 0;
+    for (; p < width; p++) {
+        unsigned long s = carry;
+        for (size_t k = 0; k < count; k++)
+            if (p < terms[k]->size)
+                s += terms[k]->value[p];
+        digits[p] = s % 10;
+        carry = s / 10;
+    }
+    while (carry != 0) {
+        digits[p++] = carry % 10;
+        carry /= 10;
+    }
+    // the sum of no operands is 0
+    if (p == 0)
+        digits[p++] = 0;
+
+    if (digits != sum.value) {
+        release(sum.value, sum.arena);
+        sum.value = digits;
+        sum.capacity = width + extra;
+        sum.arena = arena;
+    }
+    sum.size = p;
+}
+
+/** ***************************************************************************
+ *
+ * Function name: multiply_add_all
+ * Input parameters: The BigUnsigned object that receives the sum, an array
+ *              of pointers to the operands, an array of one unsigned
+ *              factor per operand and the number of operands.
+ * Returned result: None
+ * Description: This is a weighted multi-operand addition, the sum of
+ *              factors[k] * terms[k]. Like add_all, each column of digits
+ *              is summed across all operands, now multiplied by their
+ *              factors, and the carry is propagated once per column. The
+ *              digit array of sum is reused under the same conditions as
+ *              in add_all, and sum may itself be one of the operands.
+ *
+ *****************************************************************************/
+
+void BigUnsigned::multiply_add_all(BigUnsigned &sum,
+                                   const BigUnsigned *const *terms,
+                                   const unsigned *factors, size_t count) {
+    size_t width = 0;
+    unsigned long long total = 0;
+    for (size_t k = 0; k < count; k++) {
+        if (terms[k]->size > width)
+            width = terms[k]->size;
+        total += factors[k];
+    }
+
+    // the carry out of the top column is below the sum of the factors,
+    // so the result needs at most one extra digit per digit of that sum
+    size_t extra = 1;
+    for (unsigned long long c = total; c >= 10; c /= 10)
+        extra++;
+
+    unsigned char *digits = sum.value;
+    BigArena *arena = sum.arena;
+    if (sum.capacity < width + extra || arena != BigArena::current()) {
+        arena = BigArena::current();
+        digits = allocate(width + extra, arena);
+    }
+
+    unsigned long long carry = 0;
+    size_t p = 0;
+    for (; p < width; p++) {
+        unsigned long long s = carry;
+        for (size_t k = 0; k < count; k++)
+            if (p < terms[k]->size)
+                s += (unsigned long long)factors[k] * terms[k]->value[p];
+        digits[p] = s % 10;
+        carry = s / 10;
+    }
+    while (carry != 0) {
+        digits[p++] = carry % 10;
+        carry /= 10;
+    }
+
+    // drop the leading zeros that zero factors leave
+    while (p > 1 && digits[p - 1] == 0)
+        p--;
+    if (p == 0)
+        digits[p++] = 0;
+
+    if (digits != sum.value) {
+        release(sum.value, sum.arena);
+        sum.value = digits;
+        sum.capacity = width + extra;
+        sum.arena = arena;
+    }
+    sum.size = p;
+}
+
+/** ***************************************************************************
+ *
+ * Function name: operator *
+ * Input parameters: An unsigned factor.
+ * Returned result: A BigUnsigned object that is the product.
+ * Description: This is the multiplication by a machine-sized number. It
+ *              multiplies every digit by the factor in a single pass with
+ *              one carry, instead of the digit-by-digit long
+ *              multiplication of two BigUnsigned objects.
+ *
+ *****************************************************************************/
+
+BigUnsigned BigUnsigned::operator * (unsigned factor) const {
+    BigUnsigned product;
+    const BigUnsigned *terms[1] = {this};
+    multiply_add_all(product, terms, &factor, 1);
+    return product;
+}
+
+/** ***************************************************************************
+ *
+ * Function name: operator /
+ * Input parameters: An unsigned divisor, not 0.
+ * Returned result: A BigUnsigned object that is the quotient, rounded down.
+ * Description: This is the division by a machine-sized number. It is
+ *              schoolbook short division from the most significant digit
+ *              down, with the remainder carried to the next digit. It
+ *              throws std::domain_error when the divisor is 0.
+ *
+ *****************************************************************************/
+
+BigUnsigned BigUnsigned::operator / (unsigned divisor) const {
+    if (divisor == 0)
+        throw std::domain_error("BigUnsigned: division by zero");
+
+    BigUnsigned quotient = *this;
+    unsigned long long remainder = 0;
+    for (size_t p = size; p-- > 0; ) {
+        remainder = remainder * 10 + value[p];
+        quotient.value[p] = remainder / divisor;
+        remainder %= divisor;
+    }
+    while (quotient.size > 1 && quotient.value[quotient.size - 1] == 0)
+        quotient.size--;
+    return quotient;
+}
+
+/** ***************************************************************************
+ *
+ * Function name: operator %
+ * Input parameters: An unsigned divisor, not 0.
+ * Returned result: The remainder of the division by divisor.
+ * Description: This is the remainder of the short division done by
+ *              operator /. It throws std::domain_error when the divisor
+ *              is 0.
+ *
+ *****************************************************************************/
+
+unsigned BigUnsigned::operator % (unsigned divisor) const {
+    if (divisor == 0)
+        throw std::domain_error("BigUnsigned: division by zero");
+
+    unsigned long long remainder = 0;
+    for (size_t p = size; p-- > 0; )
+        remainder = (remainder * 10 + value[p]) % divisor;
+    return unsigned(remainder);
+}
+
 /** ***************************************************************************
  *
  * Function name: operator *
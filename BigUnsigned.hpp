@@ -14,13 +14,19 @@
 #define INC_454_P1_BIGUNSIGNED_HPP
 
 
+#include "BigArena.hpp"
+#include <cstdint>
 #include <iostream>
+#include <string>
+#include <string_view>
 
 /** ***************************************************************************
  *
  * Class name: BigUnsigned
  * Description: This class is designed to hold unsigned (positive) integer
  * 	values that are too large for the standard C++ unsigned data types.
+ * 	Digits are allocated from the heap, or from the BigArena that is
+ * 	active on the calling thread.
  *
  *****************************************************************************/
 
@@ -30,7 +36,7 @@ public:
     BigUnsigned();
     ~BigUnsigned();
     BigUnsigned(const BigUnsigned &other);
-    BigUnsigned(const std::string &str);
+    BigUnsigned(std::string_view str);
     size_t length() const;
     BigUnsigned &operator = (const BigUnsigned &other);
     BigUnsigned operator + (const BigUnsigned &other) const;
@@ -40,13 +46,88 @@ public:
     BigUnsigned(unsigned V);
     bool operator == (const BigUnsigned &other) const;
     bool operator < (const BigUnsigned &other) const;
-    BigUnsigned operator += (const BigUnsigned &other);
+    bool operator != (const BigUnsigned &other) const;
+    bool operator <= (const BigUnsigned &other) const;
+    bool operator > (const BigUnsigned &other) const;
+    bool operator >= (const BigUnsigned &other) const;
+    BigUnsigned &operator += (const BigUnsigned &other);
+    BigUnsigned operator - (const BigUnsigned &other) const;
+    BigUnsigned &operator -= (const BigUnsigned &other);
     BigUnsigned operator * (const BigUnsigned &other) const;
+    BigUnsigned operator * (unsigned factor) const;
+    BigUnsigned operator / (unsigned divisor) const;
+    unsigned operator % (unsigned divisor) const;
+
+    static void add_all(BigUnsigned &sum, const BigUnsigned *const *terms,
+                        size_t count);
+    static void multiply_add_all(BigUnsigned &sum,
+                                 const BigUnsigned *const *terms,
+                                 const unsigned *factors, size_t count);
+
+    template<typename Generator>
+    static BigUnsigned uniform_below(const BigUnsigned &bound, Generator &random);
 
 private:
+    static unsigned char *allocate(size_t count, BigArena *arena);
+    static void release(unsigned char *digits, BigArena *arena);
+
     size_t size;
+    size_t capacity;
     unsigned char *value;
+
+    // the arena value was taken from, nullptr for the heap
+    BigArena *arena;
 };
 
+/** ***************************************************************************
+ *
+ * Function name: uniform_below
+ * Input parameters: The bound, greater than 0, and a generator of uniform
+ *              64-bit numbers.
+ * Returned result: A BigUnsigned object drawn uniformly from 0 .. bound - 1.
+ * Description: This draws the digits of a number of the same length as the
+ *              bound and starts over until the number is below the bound.
+ *              The top digit is drawn no higher than the top digit of the
+ *              bound, so at least half of the draws are kept. Digits come
+ *              19 at a time out of the 64-bit numbers below 10^19, the
+ *              others being skipped, which keeps every digit uniform.
+ *
+ *****************************************************************************/
+
+template<typename Generator>
+BigUnsigned BigUnsigned::uniform_below(const BigUnsigned &bound, Generator &random) {
+    const uint64_t limit = 10000000000000000000u;
+    uint64_t pool = 0;
+    int left = 0;
+    auto digit = [&]() {
+        if (left == 0) {
+            do
+                pool = random();
+            while (pool >= limit);
+            left = 19;
+        }
+        unsigned d = unsigned(pool % 10);
+        pool /= 10;
+        left--;
+        return d;
+    };
+
+    // digits[0] is the most significant digit
+    std::string digits(bound.size, '0');
+    for (;;) {
+        unsigned top;
+        do
+            top = digit();
+        while (top > bound.value[bound.size - 1]);
+        digits[0] = char('0' + top);
+        for (size_t p = 1; p < bound.size; p++)
+            digits[p] = char('0' + digit());
+
+        BigUnsigned result(digits);
+        if (result < bound)
+            return result;
+    }
+}
+
 
 #endif //INC_454_P1_BIGUNSIGNED_HPP
@@ -0,0 +1,260 @@
+/** ***************************************************************************
+ * @file:   BigVector.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called BigVector
+ *  Entries are stored in decimal, one digit per byte, least significant
+ *  digit in row 0. A sum step walks the rows from the least significant
+ *  digit up; within a row the column sums of all entries are formed and
+ *  normalized together, which the AVX2 kernel does eight entries at a time.
+ *  Processors without AVX2 use the scalar kernel.
+ *
+ *****************************************************************************/
+
+#include "BigVector.hpp"
+#include <string>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BIGVECTOR_X86 1
+#include <immintrin.h>
+#endif
+
+// vector gathers load four bytes starting at the last cell they touch
+static const size_t GATHER_PADDING = 3;
+
+// largest fanout for which the column sums stay below 1029, where
+// (s * 205) >> 11 equals s / 10
+static const size_t MAX_VECTOR_FANOUT = 100;
+
+
+/** ***************************************************************************
+ * add up one digit row of the successors of every entry and normalize it
+ * @param  src: the digit row of the source vector
+ * @param  successors: fanout-major successor indices
+ * @param  fanout: number of successors per entry
+ * @param  begin: first entry to process
+ * @param  entries: number of entries
+ * @param  carry: per-entry carries, read and updated
+ * @param  dst: the digit row to write
+ *
+ *****************************************************************************/
+static void sum_row_scalar(const uint8_t *src, const int *successors,
+                           size_t fanout, size_t begin, size_t entries,
+                           uint32_t *carry, uint8_t *dst) {
+    for (size_t i = begin; i < entries; i++) {
+        uint32_t s = carry[i];
+        for (size_t j = 0; j < fanout; j++)
+            s += src[successors[j * entries + i]];
+        carry[i] = s / 10;
+        dst[i] = uint8_t(s - carry[i] * 10);
+    }
+}
+
+#ifdef BIGVECTOR_X86
+__attribute__((target("avx2")))
+static void sum_row_avx2(const uint8_t *src, const int *successors,
+                         size_t fanout, size_t entries,
+                         uint32_t *carry, uint8_t *dst) {
+    const __m256i lowByte = _mm256_set1_epi32(0xFF);
+    const __m256i ten = _mm256_set1_epi32(10);
+    const __m256i magic = _mm256_set1_epi32(205);
+    // moves the low byte of every 32-bit lane to the front of its half
+    const __m256i packBytes = _mm256_setr_epi8(
+        0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i joinHalves = _mm256_setr_epi32(0, 4, 1, 1, 1, 1, 1, 1);
+
+    size_t i = 0;
+    for (; i + 8 <= entries; i += 8) {
+        __m256i s = _mm256_loadu_si256((const __m256i *)(carry + i));
+        for (size_t j = 0; j < fanout; j++) {
+            __m256i index = _mm256_loadu_si256(
+                (const __m256i *)(successors + j * entries + i));
+            __m256i cell = _mm256_i32gather_epi32((const int *)src, index, 1);
+            s = _mm256_add_epi32(s, _mm256_and_si256(cell, lowByte));
+        }
+        __m256i q = _mm256_srli_epi32(_mm256_mullo_epi32(s, magic), 11);
+        __m256i digit = _mm256_sub_epi32(s, _mm256_mullo_epi32(q, ten));
+        _mm256_storeu_si256((__m256i *)(carry + i), q);
+
+        digit = _mm256_permutevar8x32_epi32(
+            _mm256_shuffle_epi8(digit, packBytes), joinHalves);
+        _mm_storel_epi64((__m128i *)(dst + i), _mm256_castsi256_si128(digit));
+    }
+
+    sum_row_scalar(src, successors, fanout, i, entries, carry, dst);
+}
+
+static bool has_avx2() {
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+    return avx2;
+}
+#endif
+
+
+/** ***************************************************************************
+ * BigVector constructor - create a vector of entries all equal to 0
+ * @param  entries: number of entries
+ *
+ *****************************************************************************/
+BigVector::BigVector(size_t entries) : entries(entries), digits(1),
+    cells(entries + GATHER_PADDING, 0), carry(entries, 0) { }
+
+
+/** ***************************************************************************
+ * @return the number of entries
+ *
+ *****************************************************************************/
+size_t BigVector::size() const {
+    return entries;
+}
+
+
+/** ***************************************************************************
+ * @return the number of digits shared by all entries
+ *
+ *****************************************************************************/
+size_t BigVector::width() const {
+    return digits;
+}
+
+
+/** ***************************************************************************
+ * @return the digit row for a given digit position
+ *
+ *****************************************************************************/
+uint8_t *BigVector::row(size_t digit) {
+    return cells.data() + digit * entries;
+}
+
+const uint8_t *BigVector::row(size_t digit) const {
+    return cells.data() + digit * entries;
+}
+
+
+/** ***************************************************************************
+ * grow every entry to a new width in a single step, new digits are 0
+ * @param  width: the new number of digits
+ * @pre    width >= the current number of digits
+ *
+ *****************************************************************************/
+void BigVector::widen(size_t width) {
+    // the padding is never written, so the new rows start out as 0
+    cells.resize(width * entries + GATHER_PADDING, 0);
+    digits = width;
+}
+
+
+/** ***************************************************************************
+ * set an entry to an unsigned value
+ * @param  entry: index of the entry
+ * @param  value: the value to store
+ * @pre    entry < size()
+ * @post   the vector is widened if value needs more digits than it has
+ *
+ *****************************************************************************/
+void BigVector::assign(size_t entry, unsigned value) {
+    size_t needed = 1;
+    for (unsigned v = value; v >= 10; v /= 10)
+        needed++;
+    if (needed > digits)
+        widen(needed);
+
+    for (size_t d = 0; d < digits; d++) {
+        row(d)[entry] = uint8_t(value % 10);
+        value /= 10;
+    }
+}
+
+
+/** ***************************************************************************
+ * read an entry back as a BigUnsigned
+ * @param  entry: index of the entry
+ * @pre    entry < size()
+ * @post   return the value of the entry
+ *
+ *****************************************************************************/
+BigUnsigned BigVector::at(size_t entry) const {
+    std::string text;
+    size_t d = digits;
+    // skip leading zeros
+    while (d > 1 && row(d - 1)[entry] == 0)
+        d--;
+    text.reserve(d);
+    while (d > 0)
+        text += char('0' + row(--d)[entry]);
+    return BigUnsigned(text);
+}
+
+
+/** ***************************************************************************
+ * replace every entry by the sum of some entries of another vector
+ * @remark: entry i becomes the sum over j < fanout of
+ *  source[successors[j * size() + i]], i.e. successors is stored
+ *  fanout-major so that the indices of neighbouring entries are adjacent
+ *
+ * @param  source: the vector to read from, must not be *this
+ * @param  successors: fanout * size() indices into source
+ * @param  fanout: number of terms per entry
+ * @post   the width is that of source, plus the digits of the final
+ *         carries, which are added in one step
+ *
+ *****************************************************************************/
+void BigVector::gather_sum(const BigVector &source, const int *successors,
+                           size_t fanout) {
+    if (&source == this)
+        throw std::invalid_argument("BigVector::gather_sum: source aliases the result");
+
+    if (digits != source.digits) {
+        digits = source.digits;
+        cells.assign(digits * entries + GATHER_PADDING, 0);
+    }
+    carry.assign(entries, 0);
+
+    for (size_t d = 0; d < digits; d++) {
+#ifdef BIGVECTOR_X86
+        if (fanout <= MAX_VECTOR_FANOUT && has_avx2()) {
+            sum_row_avx2(source.row(d), successors, fanout, entries,
+                         carry.data(), row(d));
+            continue;
+        }
+#endif
+        sum_row_scalar(source.row(d), successors, fanout, 0, entries,
+                       carry.data(), row(d));
+    }
+
+    // any entry that overflowed the shared width widens all of them
+    uint32_t largest = 0;
+    for (size_t i = 0; i < entries; i++)
+        if (carry[i] > largest)
+            largest = carry[i];
+    if (largest == 0)
+        return;
+
+    size_t extra = 0;
+    for (uint32_t c = largest; c > 0; c /= 10)
+        extra++;
+    size_t top = digits;
+    widen(digits + extra);
+    for (size_t d = top; d < digits; d++) {
+        uint8_t *r = row(d);
+        for (size_t i = 0; i < entries; i++) {
+            r[i] = uint8_t(carry[i] % 10);
+            carry[i] /= 10;
+        }
+    }
+}
+
+
+/** ***************************************************************************
+ * exchange the contents of two vectors
+ *
+ *****************************************************************************/
+void BigVector::swap(BigVector &other) {
+    std::swap(entries, other.entries);
+    std::swap(digits, other.digits);
+    cells.swap(other.cells);
+    carry.swap(other.carry);
+}
@@ -0,0 +1,53 @@
+/** ***************************************************************************
+ * @file:   BigVector.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called BigVector
+ * @remark: A BigVector holds a fixed number of unsigned values that are too
+ *  large for the standard C++ unsigned data types, like a vector of
+ *  BigUnsigned, but all entries share one width and the decimal digits are
+ *  stored digit-major: row d holds digit d of every entry. A step of the
+ *  counting algorithm, where every entry becomes the sum of a few entries
+ *  of the previous vector, then works on whole rows at a time instead of
+ *  on many small, separately allocated digit arrays.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_BIGVECTOR_HPP
+#define INC_454_P1_BIGVECTOR_HPP
+
+
+#include "BigUnsigned.hpp"
+#include <vector>
+#include <cstdint>
+
+class BigVector {
+public:
+    explicit BigVector(size_t entries = 0);
+    size_t size() const;
+    size_t width() const;
+    void assign(size_t entry, unsigned value);
+    BigUnsigned at(size_t entry) const;
+    void gather_sum(const BigVector &source, const int *successors,
+                    size_t fanout);
+    void swap(BigVector &other);
+
+private:
+    uint8_t *row(size_t digit);
+    const uint8_t *row(size_t digit) const;
+    void widen(size_t digits);
+
+    // number of entries and number of digits per entry
+    size_t entries;
+    size_t digits;
+
+    // digit-major storage, entries * digits cells, padded at the end so
+    // that vector gathers may read a few bytes past the last row
+    std::vector<uint8_t> cells;
+
+    // per-entry carries used by gather_sum
+    std::vector<uint32_t> carry;
+};
+
+
+#endif //INC_454_P1_BIGVECTOR_HPP
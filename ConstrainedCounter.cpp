@@ -0,0 +1,154 @@
+/** ***************************************************************************
+ * @file:   ConstrainedCounter.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  ConstrainedCounter
+ *
+ *****************************************************************************/
+
+#include "ConstrainedCounter.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+
+/** ***************************************************************************
+ * ConstrainedCounter constructor
+ * @param  dfa: the DFA M, must outlive the counter
+ * @param  maxTables: the most tables C_S to keep, at least 1
+ *
+ *****************************************************************************/
+template<typename T>
+ConstrainedCounter<T>::ConstrainedCounter(const DFA<T> &dfa, int maxTables)
+    : dfa(dfa), delta(TransitionTable(dfa).minimized()), maxTables(maxTables) {
+    if (maxTables < 1)
+        throw std::invalid_argument("ConstrainedCounter: at least one table must be kept");
+}
+
+
+/** ***************************************************************************
+ * @param  state: the state to start in
+ * @param  begin, end: the symbols to run, which may lie outside Σ
+ * @return the state reached
+ *
+ *****************************************************************************/
+template<typename T>
+int ConstrainedCounter<T>::run(int state, const T *begin, const T *end) const {
+    for (const T *symbol = begin; symbol != end; symbol++)
+        state = delta.next(state, dfa.symbol_class(*symbol));
+    return state;
+}
+
+
+/** ***************************************************************************
+ * @return the table C_S of a suffix, found through the suffix if it is
+ *  remembered, else through its set R_S if that is kept, else a new one
+ *  that replaces the table used longest ago when maxTables are kept
+ *
+ *****************************************************************************/
+template<typename T>
+CountTable<BigUnsigned> &ConstrainedCounter<T>::table_for(const String &suffix) {
+    queries++;
+    auto known = suffixTables.find(suffix);
+    if (known != suffixTables.end()) {
+        known->second->second.used = queries;
+        return known->second->second.table;
+    }
+
+    std::vector<bool> ends(delta.states());
+    for (int r = 0; r < delta.states(); r++)
+        ends[r] = delta.accepting(run(r, suffix.data(), suffix.data() + suffix.size()));
+
+    auto found = setTables.find(ends);
+    if (found == setTables.end()) {
+        if (int(setTables.size()) >= maxTables) {
+            auto oldest = setTables.begin();
+            for (auto entry = setTables.begin(); entry != setTables.end(); ++entry)
+                if (entry->second.used < oldest->second.used)
+                    oldest = entry;
+            for (const String &gone : oldest->second.suffixes)
+                suffixTables.erase(gone);
+            setTables.erase(oldest);
+        }
+
+        std::vector<BigUnsigned> first(delta.states());
+        for (int r = 0; r < delta.states(); r++)
+            first[r] = BigUnsigned(ends[r] ? 1 : 0);
+        Entry entry{CountTable<BigUnsigned>(delta, dfa.table_width() - 1, std::move(first)),
+                    queries, {}};
+        found = setTables.emplace(std::move(ends), std::move(entry)).first;
+    }
+
+    // the suffixes are only shortcuts, so all are dropped at the limit
+    if (suffixTables.size() >= MAX_SUFFIXES) {
+        suffixTables.clear();
+        for (auto &entry : setTables)
+            entry.second.suffixes.clear();
+    }
+    suffixTables.emplace(suffix, found);
+    found->second.suffixes.push_back(suffix);
+    found->second.used = queries;
+    return found->second.table;
+}
+
+
+/** ***************************************************************************
+ * count the accepted strings with a given prefix and suffix
+ * @param  n: the length of the strings, n >= 0
+ * @param  prefix: the symbols the strings start with
+ * @param  suffix: the symbols the strings end with
+ * @post   return the number of strings of length n accepted by M that
+ *         start with prefix and end with suffix; when n < |P| + |S| the
+ *         two overlap and there is at most one such string
+ *
+ *****************************************************************************/
+template<typename T>
+BigUnsigned ConstrainedCounter<T>::count(int n, const String &prefix,
+                                         const String &suffix) {
+    if (n < 0)
+        throw std::invalid_argument("ConstrainedCounter: negative length");
+    const size_t length = size_t(n);
+    if (length < prefix.size() || length < suffix.size())
+        return BigUnsigned(0);
+
+    if (length < prefix.size() + suffix.size()) {
+        size_t overlap = prefix.size() + suffix.size() - length;
+        const T *p = prefix.data(), *s = suffix.data();
+        if (!std::equal(p + prefix.size() - overlap, p + prefix.size(), s))
+            return BigUnsigned(0);
+        int q = run(run(delta.start(), p, p + prefix.size()), s + overlap,
+                    s + suffix.size());
+        return BigUnsigned(delta.accepting(q) ? 1 : 0);
+    }
+
+    int middle = int(length - prefix.size() - suffix.size());
+    CountTable<BigUnsigned> &table = table_for(suffix);
+    table.extend(middle);
+    return table.row(middle)[run(delta.start(), prefix.data(),
+                                 prefix.data() + prefix.size())];
+}
+
+
+/** ***************************************************************************
+ * @return the number of tables kept
+ *
+ *****************************************************************************/
+template<typename T>
+int ConstrainedCounter<T>::tables() const {
+    return int(setTables.size());
+}
+
+
+/** ***************************************************************************
+ * release all tables
+ *
+ *****************************************************************************/
+template<typename T>
+void ConstrainedCounter<T>::forget() {
+    suffixTables.clear();
+    setTables.clear();
+}
+
+template class ConstrainedCounter<char>;
+template class ConstrainedCounter<unsigned char>;
+template class ConstrainedCounter<char32_t>;
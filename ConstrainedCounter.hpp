@@ -0,0 +1,83 @@
+/** ***************************************************************************
+ * @file:   ConstrainedCounter.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called
+ *  ConstrainedCounter
+ * @remark: A ConstrainedCounter counts the strings of length n accepted by
+ *  M that start with a prefix P and end with a suffix S. Running P
+ *  through δ gives the state p the middle part starts in; the middle part
+ *  x, of length m = n - |P| - |S|, must lead to a state r from which S
+ *  leads into F. So the answer is
+ *      C_S(p, m), where C_S(r, 0) = 1 if δ*(r, S) ∈ F, else 0
+ *                 and C_S(q, k) = Σ over letters σ of C_S(δ(q, σ), k - 1)
+ *  which is a CountTable whose first row is the set R_S of states r with
+ *  δ*(r, S) ∈ F. The table depends on S only through R_S, so it is kept
+ *  per set rather than per suffix: every suffix that leads into F from
+ *  the same states shares it, and the empty suffix and every suffix that
+ *  M can always complete share the one of R = F. Building the rows up to
+ *  m for a new set costs O(m |Q| |Σ|) BigUnsigned additions and keeps
+ *  m |Q| counts. Finding R_S of a new suffix costs O(|S| |Q|) steps, the
+ *  runs of S from every state; the suffixes of the kept tables are
+ *  remembered, so a suffix asked for again costs O(|P| + |S|), the walk
+ *  through P and the lookup of S.
+ *
+ *  At most maxTables tables are kept; when a new one is needed the one
+ *  used longest ago is dropped, with the suffixes that led to it. At most
+ *  MAX_SUFFIXES suffixes are remembered.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_CONSTRAINEDCOUNTER_HPP
+#define INC_454_P1_CONSTRAINEDCOUNTER_HPP
+
+
+#include "DFA.hpp"
+#include "CountTable.hpp"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+template<typename T>
+class ConstrainedCounter {
+public:
+    typedef typename DFA<T>::String String;
+    static constexpr int MAX_TABLES = 16;
+    static constexpr size_t MAX_SUFFIXES = 1024;
+
+    explicit ConstrainedCounter(const DFA<T> &dfa, int maxTables = MAX_TABLES);
+    BigUnsigned count(int n, const String &prefix, const String &suffix);
+    int tables() const;
+    void forget();
+
+private:
+    int run(int state, const T *begin, const T *end) const;
+    CountTable<BigUnsigned> &table_for(const String &suffix);
+
+    // a kept table, the query that used it last and the suffixes
+    // remembered as leading to it
+    struct Entry {
+        CountTable<BigUnsigned> table;
+        uint64_t used;
+        std::vector<String> suffixes;
+    };
+    typedef std::map<std::vector<bool>, Entry> SetTables;
+
+    const DFA<T> &dfa;
+
+    // the minimized δ
+    TransitionTable delta;
+
+    // C_S for the sets R_S of the latest suffixes asked for, keyed by the
+    // membership of every state in R_S
+    SetTables setTables;
+    int maxTables;
+
+    // the kept table of every suffix remembered
+    std::map<String, typename SetTables::iterator> suffixTables;
+    uint64_t queries = 0;
+};
+
+
+#endif //INC_454_P1_CONSTRAINEDCOUNTER_HPP
@@ -0,0 +1,171 @@
+/** ***************************************************************************
+ * @file:   CostCounter.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  CostCounter. Row c of the DP lives in slot c mod (max c(σ) + 1) of the
+ *  ring, so the rows it reads are still there and the one it overwrites
+ *  is no longer needed.
+ *
+ *****************************************************************************/
+
+#include "CostCounter.hpp"
+#include <stdexcept>
+
+
+/** ***************************************************************************
+ * CostCounter constructor
+ * @param  dfa: the DFA M
+ * @param  costs: the cost of every letter, in the order of the symbol
+ *         classes of M, each at least 1
+ *
+ *****************************************************************************/
+template<typename T>
+CostCounter::CostCounter(const DFA<T> &dfa, const std::vector<unsigned> &costs)
+    : delta(TransitionTable(dfa).minimized()), symbols(dfa.table_width() - 1),
+      cost(costs), maxCost(0) {
+    if (cost.size() != size_t(symbols))
+        throw std::invalid_argument("CostCounter: one cost per letter needed");
+    for (unsigned c : cost) {
+        // a letter of cost 0 would give infinitely many strings of one cost
+        if (c == 0)
+            throw std::invalid_argument("CostCounter: costs must be positive");
+        if (c > maxCost)
+            maxCost = c;
+    }
+}
+
+
+/** ***************************************************************************
+ * @return the number of letters, |Σ|
+ *
+ *****************************************************************************/
+int CostCounter::letters() const {
+    return symbols;
+}
+
+
+/** ***************************************************************************
+ * @param  budget: the cost C
+ * @return the number of strings of cost exactly C accepted by M
+ *
+ *****************************************************************************/
+BigUnsigned CostCounter::exactly(unsigned budget) const {
+    return run(budget, BigUnsigned(1), BigUnsigned::add_all,
+               [](const BigUnsigned &) { });
+}
+
+
+/** ***************************************************************************
+ * @param  budget: the cost C
+ * @return the number of strings of cost at most C accepted by M
+ *
+ *****************************************************************************/
+BigUnsigned CostCounter::at_most(unsigned budget) const {
+    BigUnsigned total;
+    run(budget, BigUnsigned(1), BigUnsigned::add_all,
+        [&total](const BigUnsigned &count) { total += count; });
+    return total;
+}
+
+
+/** ***************************************************************************
+ * sum the count terms modulo a number
+ * @param  modulus: the modulus, 1 <= modulus <= 2^63
+ * @post   return a sum functor for run
+ *
+ *****************************************************************************/
+static auto sum_mod(uint64_t modulus) {
+    if (modulus == 0 || modulus > (uint64_t(1) << 63))
+        throw std::invalid_argument("CostCounter: modulus out of range");
+    return [modulus](uint64_t &sum, const uint64_t *const *terms, size_t count) {
+        sum = 0;
+        for (size_t t = 0; t < count; t++) {
+            sum += *terms[t];
+            if (sum >= modulus)
+                sum -= modulus;
+        }
+    };
+}
+
+
+/** ***************************************************************************
+ * @param  budget: the cost C
+ * @param  modulus: the modulus, 1 <= modulus <= 2^63
+ * @return the number of strings of cost exactly C accepted by M, modulo
+ *         modulus
+ *
+ *****************************************************************************/
+uint64_t CostCounter::exactly_mod(unsigned budget, uint64_t modulus) const {
+    auto sum = sum_mod(modulus);
+    return run(budget, uint64_t(1) % modulus, sum, [](uint64_t) { });
+}
+
+
+/** ***************************************************************************
+ * @param  budget: the cost C
+ * @param  modulus: the modulus, 1 <= modulus <= 2^63
+ * @return the number of strings of cost at most C accepted by M, modulo
+ *         modulus
+ *
+ *****************************************************************************/
+uint64_t CostCounter::at_most_mod(unsigned budget, uint64_t modulus) const {
+    auto sum = sum_mod(modulus);
+    uint64_t total = 0;
+    run(budget, uint64_t(1) % modulus, sum, [&](uint64_t count) {
+        total += count;
+        if (total >= modulus)
+            total -= modulus;
+    });
+    return total;
+}
+
+
+/** ***************************************************************************
+ * run the DP over (state, cost)
+ * @param  budget: the cost C
+ * @param  one: the count 1
+ * @param  sum: sets its first argument to the sum of the count terms its
+ *         second argument points to
+ * @param  visit: called with N(q₀, c) for every c = 0 .. C in order
+ * @post   return N(q₀, C)
+ *
+ *****************************************************************************/
+template<typename Number, typename Sum, typename Visit>
+Number CostCounter::run(unsigned budget, const Number &one, const Sum &sum,
+                        const Visit &visit) const {
+    const int states = delta.states();
+    const size_t depth = size_t(maxCost) + 1;
+    std::vector<Number> ring(depth * states, Number(0));
+    for (int q = 0; q < states; q++)
+        if (delta.accepting(q))
+            ring[q] = one;
+    visit(ring[delta.start()]);
+
+    // the row each letter affordable at cost c reads, and that letter
+    std::vector<const Number *> source(symbols);
+    std::vector<int> letter(symbols);
+    std::vector<const Number *> terms(symbols);
+    Number *row = ring.data();
+    for (size_t c = 1; c <= budget; c++) {
+        size_t count = 0;
+        for (int s = 0; s < symbols; s++) {
+            if (cost[s] <= c) {
+                source[count] = ring.data() + ((c - cost[s]) % depth) * states;
+                letter[count++] = s;
+            }
+        }
+        row = ring.data() + (c % depth) * states;
+        for (int q = 0; q < states; q++) {
+            for (size_t t = 0; t < count; t++)
+                terms[t] = source[t] + delta.next(q, letter[t]);
+            sum(row[q], terms.data(), count);
+        }
+        visit(row[delta.start()]);
+    }
+    return row[delta.start()];
+}
+
+template CostCounter::CostCounter(const DFA<char> &dfa, const std::vector<unsigned> &costs);
+template CostCounter::CostCounter(const DFA<unsigned char> &dfa, const std::vector<unsigned> &costs);
+template CostCounter::CostCounter(const DFA<char32_t> &dfa, const std::vector<unsigned> &costs);
@@ -0,0 +1,54 @@
+/** ***************************************************************************
+ * @file:   CostCounter.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called CostCounter
+ * @remark: A CostCounter counts the strings accepted by M by their total
+ *  cost instead of their length. Each letter σ has an integer cost
+ *  c(σ) >= 1, the cost of a string is the sum of the costs of its
+ *  letters, and the counting DP runs over (state, cost):
+ *      N(q, 0) = 1 if q ∈ F, else 0
+ *      N(q, c) = Σ over letters σ with c(σ) <= c of N(δ(q, σ), c - c(σ))
+ *  Row c only reads the rows c - 1 .. c - max c(σ), so the rows are kept
+ *  in a ring of max c(σ) + 1 rows and memory is O(|Q| max c(σ)) for any
+ *  bound C. With every cost 1 the count of cost exactly C is the count of
+ *  length C. The counts are BigUnsigned or residues modulo a 64-bit
+ *  number.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_COSTCOUNTER_HPP
+#define INC_454_P1_COSTCOUNTER_HPP
+
+
+#include "DFA.hpp"
+#include "TransitionTable.hpp"
+#include <cstdint>
+#include <vector>
+
+class CostCounter {
+public:
+    template<typename T>
+    CostCounter(const DFA<T> &dfa, const std::vector<unsigned> &costs);
+    int letters() const;
+    BigUnsigned exactly(unsigned budget) const;
+    BigUnsigned at_most(unsigned budget) const;
+    uint64_t exactly_mod(unsigned budget, uint64_t modulus) const;
+    uint64_t at_most_mod(unsigned budget, uint64_t modulus) const;
+
+private:
+    template<typename Number, typename Sum, typename Visit>
+    Number run(unsigned budget, const Number &one, const Sum &sum,
+               const Visit &visit) const;
+
+    // the minimized δ
+    TransitionTable delta;
+    int symbols;
+
+    // the cost of every letter and the largest of them
+    std::vector<unsigned> cost;
+    unsigned maxCost;
+};
+
+
+#endif //INC_454_P1_COSTCOUNTER_HPP
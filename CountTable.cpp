@@ -0,0 +1,177 @@
+/** ***************************************************************************
+ * @file:   CountTable.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class template called
+ *  CountTable
+ *
+ *****************************************************************************/
+
+#include "CountTable.hpp"
+#include <stdexcept>
+#include <type_traits>
+
+
+/** ***************************************************************************
+ * CountTable constructor - start with the row of length 0
+ * @param  delta: the transitions to count, e.g. the minimized δ of M
+ * @param  letters: number of symbol classes that are letters, 1 <= letters
+ *         <= delta.width()
+ *
+ *****************************************************************************/
+template<typename Number>
+CountTable<Number>::CountTable(const TransitionTable &delta, int letters)
+    : delta(delta), symbols(letters) {
+    if (letters < 1 || letters > delta.width())
+        throw std::invalid_argument("CountTable: letters out of range");
+    std::vector<Number> first(delta.states());
+    for (int q = 0; q < delta.states(); q++)
+        first[q] = Number(delta.accepting(q) ? 1 : 0);
+    rows.push_back(std::move(first));
+}
+
+
+/** ***************************************************************************
+ * CountTable constructor - start with a given row of length 0
+ * @param  delta: the transitions to count
+ * @param  letters: number of symbol classes that are letters
+ * @param  first: count(q, 0) for every state q
+ *
+ *****************************************************************************/
+template<typename Number>
+CountTable<Number>::CountTable(const TransitionTable &delta, int letters,
+                               std::vector<Number> first)
+    : delta(delta), symbols(letters) {
+    if (letters < 1 || letters > delta.width())
+        throw std::invalid_argument("CountTable: letters out of range");
+    if (first.size() != size_t(delta.states()))
+        throw std::invalid_argument("CountTable: first row has the wrong size");
+    rows.push_back(std::move(first));
+}
+
+
+/** ***************************************************************************
+ * @return the number of states
+ *
+ *****************************************************************************/
+template<typename Number>
+int CountTable<Number>::states() const {
+    return delta.states();
+}
+
+
+/** ***************************************************************************
+ * @return the number of letters
+ *
+ *****************************************************************************/
+template<typename Number>
+int CountTable<Number>::letters() const {
+    return symbols;
+}
+
+
+/** ***************************************************************************
+ * @return the largest length whose row has been computed
+ *
+ *****************************************************************************/
+template<typename Number>
+int CountTable<Number>::length() const {
+    return int(rows.size()) - 1;
+}
+
+
+/** ***************************************************************************
+ * compute the rows up to a length
+ * @param  n: the length
+ * @post   length() >= n; rows returned before stay valid
+ *
+ *****************************************************************************/
+template<typename Number>
+void CountTable<Number>::extend(int n) {
+    while (length() < n) {
+        std::vector<Number> current(delta.states());
+        step(delta, symbols, rows.back(), current);
+
+        if constexpr (std::is_floating_point<Number>::value) {
+            Number largest = 0;
+            for (const Number &value : current)
+                if (value > largest)
+                    largest = value;
+            if (largest > 0)
+                for (Number &value : current)
+                    value /= largest;
+        }
+        rows.push_back(std::move(current));
+    }
+}
+
+
+/** ***************************************************************************
+ * compute one row of the counting DP from the row before it, with a
+ *  weight per letter if given:
+ *      current[q] = Σ over letters σ of w(σ) previous[δ(q, σ)]
+ * @param  delta: the transitions to count
+ * @param  letters: number of symbol classes that are letters
+ * @param  previous: the row of length k - 1
+ * @param  current: set to the row of length k, the size of previous
+ * @param  weights: the weight of every letter, or nullptr for weight 1
+ * @remark: used by extend and by callers that keep only two rows
+ *
+ *****************************************************************************/
+template<typename Number>
+void CountTable<Number>::step(const TransitionTable &delta, int letters,
+                              const std::vector<Number> &previous,
+                              std::vector<Number> &current,
+                              const unsigned *weights) {
+    const int states = delta.states();
+    std::vector<const Number *> terms(letters);
+    for (int q = 0; q < states; q++) {
+        if constexpr (std::is_same<Number, BigUnsigned>::value) {
+            // one carry pass for all terms
+            for (int s = 0; s < letters; s++)
+                terms[s] = &previous[delta.next(q, s)];
+            if (weights)
+                BigUnsigned::multiply_add_all(current[q], terms.data(), weights,
+                                              letters);
+            else
+                BigUnsigned::add_all(current[q], terms.data(), letters);
+        }
+        else {
+            Number sum(0);
+            for (int s = 0; s < letters; s++) {
+                if (weights)
+                    sum += previous[delta.next(q, s)] * Number(weights[s]);
+                else
+                    sum += previous[delta.next(q, s)];
+            }
+            current[q] = sum;
+        }
+    }
+}
+
+
+/** ***************************************************************************
+ * @param  k: the length, 0 <= k <= length()
+ * @return count(q, k) for every state q
+ *
+ *****************************************************************************/
+template<typename Number>
+const Number *CountTable<Number>::row(int k) const {
+    if (k < 0 || k > length())
+        throw std::out_of_range("CountTable::row: length not computed");
+    return rows[k].data();
+}
+
+
+/** ***************************************************************************
+ * @return the transitions that are counted
+ *
+ *****************************************************************************/
+template<typename Number>
+const TransitionTable &CountTable<Number>::transitions() const {
+    return delta;
+}
+
+template class CountTable<DFA<char>::FixedCount>;
+template class CountTable<double>;
+template class CountTable<BigUnsigned>;
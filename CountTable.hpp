@@ -0,0 +1,60 @@
+/** ***************************************************************************
+ * @file:   CountTable.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class template called
+ *  CountTable
+ * @remark: A CountTable<Number> keeps, for every length k computed so
+ *  far, the number of strings of length k accepted from each state:
+ *      count(q, 0) = 1 if q ∈ F, else 0
+ *      count(q, k) = Σ over letters σ of count(δ(q, σ), k - 1)
+ *  The first row may also be given, e.g. to count the strings that lead
+ *  into some other set of states. Rows are added on demand and never
+ *  move, so a row stays valid while the table grows. Samplers and rankers
+ *  walk δ and weigh every step by the row of the remaining length.
+ *
+ *  With a floating-point Number every row is scaled so that its largest
+ *  entry is 1, which keeps any length in range; then only ratios of
+ *  entries of the same row are meaningful.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_COUNTTABLE_HPP
+#define INC_454_P1_COUNTTABLE_HPP
+
+
+#include "TransitionTable.hpp"
+#include <deque>
+#include <vector>
+
+template<typename Number>
+class CountTable {
+public:
+    CountTable(const TransitionTable &delta, int letters);
+    CountTable(const TransitionTable &delta, int letters,
+               std::vector<Number> first);
+    int states() const;
+    int letters() const;
+    int length() const;
+    void extend(int n);
+    const Number *row(int k) const;
+    const TransitionTable &transitions() const;
+
+    static void step(const TransitionTable &delta, int letters,
+                     const std::vector<Number> &previous,
+                     std::vector<Number> &current,
+                     const unsigned *weights = nullptr);
+
+private:
+    TransitionTable delta;
+
+    // the symbol classes 0 .. symbols - 1 are counted, the classes above
+    // them (symbols outside Σ) are not
+    int symbols;
+
+    // rows[k][q] = count(q, k)
+    std::deque<std::vector<Number>> rows;
+};
+
+
+#endif //INC_454_P1_COUNTTABLE_HPP
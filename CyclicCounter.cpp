@@ -0,0 +1,256 @@
+/** ***************************************************************************
+ * @file:   CyclicCounter.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  CyclicCounter. The states of G are found by running every word of
+ *  WINDOW - 1 letters from q₀, and the orbits by running every renaming
+ *  of those words, so only the public tables of M are used.
+ *
+ *****************************************************************************/
+
+#include "CyclicCounter.hpp"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+
+
+/** ***************************************************************************
+ * CyclicCounter constructor - build G and its orbits
+ * @param  dfa: the DFA M
+ *
+ *****************************************************************************/
+template<typename T>
+CyclicCounter::CyclicCounter(const DFA<T> &dfa) : symbols(dfa.table_width() - 1) {
+    const int *table = dfa.transition_table();
+    const int width = dfa.table_width();
+    const int length = DFA<T>::WINDOW - 1;
+    auto run = [&](const std::vector<int> &word) {
+        int q = DFA<T>::START;
+        for (int symbol : word)
+            q = table[q * width + symbol];
+        return q;
+    };
+
+    // the state of M after every word of length WINDOW - 1
+    size_t words = 1;
+    for (int i = 0; i < length; i++)
+        words *= symbols;
+    std::vector<std::vector<int>> word(words, std::vector<int>(length));
+    std::vector<int> stateOf(words);
+    std::vector<int> index(DFA<T>::STATES, -1);
+    for (size_t w = 0; w < words; w++) {
+        size_t rest = w;
+        for (int i = length - 1; i >= 0; i--) {
+            word[w][i] = int(rest % symbols);
+            rest /= symbols;
+        }
+        stateOf[w] = run(word[w]);
+        if (stateOf[w] != DFA<T>::DEAD)
+            index[stateOf[w]] = int(w);
+    }
+
+    // drop states without a successor or predecessor until none is left
+    std::vector<bool> keep(words);
+    for (size_t w = 0; w < words; w++)
+        keep[w] = stateOf[w] != DFA<T>::DEAD;
+    auto successor = [&](size_t w, int s) {
+        int q = table[stateOf[w] * width + s];
+        return q == DFA<T>::DEAD ? -1 : index[q];
+    };
+    for (bool changed = true; changed; ) {
+        changed = false;
+        std::vector<int> in(words, 0), out(words, 0);
+        for (size_t w = 0; w < words; w++) {
+            if (!keep[w])
+                continue;
+            for (int s = 0; s < symbols; s++) {
+                int v = successor(w, s);
+                if (v >= 0 && keep[v]) {
+                    out[w]++;
+                    in[v]++;
+                }
+            }
+        }
+        for (size_t w = 0; w < words; w++) {
+            if (keep[w] && (in[w] == 0 || out[w] == 0)) {
+                keep[w] = false;
+                changed = true;
+            }
+        }
+    }
+
+    std::vector<int> number(words, -1);
+    states = 0;
+    for (size_t w = 0; w < words; w++)
+        if (keep[w])
+            number[w] = states++;
+    next.assign(size_t(states) * symbols, -1);
+    for (size_t w = 0; w < words; w++) {
+        if (!keep[w])
+            continue;
+        for (int s = 0; s < symbols; s++) {
+            int v = successor(w, s);
+            if (v >= 0 && keep[v])
+                next[number[w] * symbols + s] = number[v];
+        }
+    }
+
+    // the orbit of every kept word under the renamings of the letters
+    std::vector<bool> seen(words, false);
+    std::vector<int> renaming(symbols);
+    for (size_t w = 0; w < words; w++) {
+        if (!keep[w] || seen[w])
+            continue;
+        unsigned size = 0;
+        std::iota(renaming.begin(), renaming.end(), 0);
+        do {
+            size_t image = 0;
+            for (int i = 0; i < length; i++)
+                image = image * symbols + renaming[word[w][i]];
+            if (!seen[image]) {
+                seen[image] = true;
+                size++;
+            }
+        } while (std::next_permutation(renaming.begin(), renaming.end()));
+        representative.push_back(number[w]);
+        orbitSize.push_back(size);
+    }
+}
+
+
+/** ***************************************************************************
+ * @return the number of states of M that lie on a cycle
+ *
+ *****************************************************************************/
+int CyclicCounter::cycle_states() const {
+    return states;
+}
+
+
+/** ***************************************************************************
+ * @return the number of orbits of those states under renaming the letters
+ *
+ *****************************************************************************/
+int CyclicCounter::orbits() const {
+    return int(representative.size());
+}
+
+
+/** ***************************************************************************
+ * count the closed walks of several lengths in one run of the DP
+ * @param  wanted: wanted[k] is true for every length k whose trace is
+ *         needed, k <= n = wanted.size() - 1
+ * @post   return trace(A^k) at k for every wanted k, 0 elsewhere; the
+ *         DP from each representative runs n steps once and is read off
+ *         after every step
+ *
+ *****************************************************************************/
+template<typename Number>
+std::vector<Number> CyclicCounter::traces(const std::vector<bool> &wanted) const {
+    const int n = int(wanted.size()) - 1;
+    std::vector<Number> total(n + 1, Number(0));
+    std::vector<Number> previous(states), current(states);
+    std::vector<const Number *> terms(symbols);
+    for (size_t r = 0; r < representative.size(); r++) {
+        // current[v] = number of walks of length k from v to the
+        // representative
+        for (int v = 0; v < states; v++)
+            current[v] = Number(v == representative[r] ? 1 : 0);
+        for (int k = 1; k <= n; k++) {
+            previous.swap(current);
+            for (int v = 0; v < states; v++) {
+                size_t count = 0;
+                for (int s = 0; s < symbols; s++) {
+                    int u = next[v * symbols + s];
+                    if (u >= 0)
+                        terms[count++] = &previous[u];
+                }
+                if constexpr (std::is_same<Number, BigUnsigned>::value) {
+                    BigUnsigned::add_all(current[v], terms.data(), count);
+                }
+                else {
+                    Number sum(0);
+                    for (size_t t = 0; t < count; t++)
+                        sum += *terms[t];
+                    current[v] = sum;
+                }
+            }
+
+            if (!wanted[k])
+                continue;
+            // every state of the orbit closes as many walks
+            total[k] += current[representative[r]] * orbitSize[r];
+        }
+    }
+    return total;
+}
+
+
+/** ***************************************************************************
+ * count the circular words of length n, trace(A^n)
+ * @param  n: the length, n >= 1
+ * @post   return the number of words of length n all of whose circular
+ *         windows hold every letter; rotations count separately
+ * @throws std::out_of_range if Number is FixedCount and n > FIXED_MAX_N
+ *
+ *****************************************************************************/
+template<typename Number>
+Number CyclicCounter::circular_words(int n) const {
+    if (n < 1)
+        throw std::invalid_argument("CyclicCounter: length must be positive");
+    if constexpr (std::is_same<Number, DFA<char>::FixedCount>::value) {
+        if (n > DFA<char>::FIXED_MAX_N)
+            throw std::out_of_range("CyclicCounter: FixedCount needs n <= FIXED_MAX_N");
+    }
+
+    std::vector<bool> wanted(n + 1, false);
+    wanted[n] = true;
+    return traces<Number>(wanted)[n];
+}
+
+
+/** ***************************************************************************
+ * count the necklaces of length n, circular words up to rotation
+ * @param  n: the length, n >= 1
+ * @post   return the number of necklaces of length n all of whose windows
+ *         hold every letter
+ *
+ *****************************************************************************/
+BigUnsigned CyclicCounter::necklaces(int n) const {
+    if (n < 1)
+        throw std::invalid_argument("CyclicCounter: length must be positive");
+
+    // the traces of every divisor come out of one run
+    std::vector<bool> divisors(n + 1, false);
+    for (int d = 1; d <= n; d++)
+        divisors[d] = n % d == 0;
+    std::vector<BigUnsigned> trace = traces<BigUnsigned>(divisors);
+
+    BigUnsigned sum;
+    for (int d = 1; d <= n; d++) {
+        if (!divisors[d])
+            continue;
+        // φ(n / d)
+        unsigned m = unsigned(n / d);
+        unsigned phi = m;
+        for (unsigned p = 2; p * p <= m; p++) {
+            if (m % p == 0) {
+                while (m % p == 0)
+                    m /= p;
+                phi -= phi / p;
+            }
+        }
+        if (m > 1)
+            phi -= phi / m;
+        sum += trace[d] * phi;
+    }
+    return sum / unsigned(n);
+}
+
+template CyclicCounter::CyclicCounter(const DFA<char> &dfa);
+template CyclicCounter::CyclicCounter(const DFA<unsigned char> &dfa);
+template CyclicCounter::CyclicCounter(const DFA<char32_t> &dfa);
+template BigUnsigned CyclicCounter::circular_words<BigUnsigned>(int n) const;
+template DFA<char>::FixedCount CyclicCounter::circular_words<DFA<char>::FixedCount>(int n) const;
@@ -0,0 +1,66 @@
+/** ***************************************************************************
+ * @file:   CyclicCounter.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called
+ *  CyclicCounter
+ * @remark: A CyclicCounter counts circular strings: words w of length n
+ *  over Σ such that every window of WINDOW consecutive symbols of w read
+ *  around the circle holds every letter. Once M has read WINDOW - 1
+ *  symbols its state is the last WINDOW - 1 of them, so these states and
+ *  the transitions between them that do not die form a graph G in which
+ *  a closed walk of length n is exactly such a circular word. The count
+ *  is the trace of A^n, A the adjacency matrix of G.
+ *
+ *  The trace is summed over the diagonal without eigenvalues: the number
+ *  of closed walks through a state v is a counting DP from v. Renaming
+ *  the letters maps closed walks to closed walks, so only one state per
+ *  orbit under the permutations of Σ is run, weighted by the size of its
+ *  orbit; for L the 840 states that lie on cycles form 35 orbits of 24.
+ *  States that lie on no cycle are dropped first.
+ *
+ *  A necklace is a circular word up to rotation. By Burnside's lemma,
+ *  with φ Euler's function,
+ *      necklaces(n) = (1/n) Σ over d | n of φ(n / d) trace(A^d)
+ *  since a rotation by k fixes the words made of n / gcd(n, k) copies of
+ *  one circular word of length gcd(n, k). The DP that gives trace(A^n)
+ *  passes through every shorter length, so the traces of all divisors
+ *  are read off one run of it.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_CYCLICCOUNTER_HPP
+#define INC_454_P1_CYCLICCOUNTER_HPP
+
+
+#include "DFA.hpp"
+#include <vector>
+
+class CyclicCounter {
+public:
+    template<typename T>
+    explicit CyclicCounter(const DFA<T> &dfa);
+    template<typename Number>
+    Number circular_words(int n) const;
+    BigUnsigned necklaces(int n) const;
+    int cycle_states() const;
+    int orbits() const;
+
+private:
+    template<typename Number>
+    std::vector<Number> traces(const std::vector<bool> &wanted) const;
+
+    int symbols;
+
+    // G restricted to the states on cycles, numbered 0 .. states - 1;
+    // next[v * symbols + σ] is the successor on σ, or -1
+    int states;
+    std::vector<int> next;
+
+    // one state per orbit and the size of its orbit
+    std::vector<int> representative;
+    std::vector<unsigned> orbitSize;
+};
+
+
+#endif //INC_454_P1_CYCLICCOUNTER_HPP
@@ -14,26 +14,62 @@
  *****************************************************************************/
 
 #include "DFA.hpp"
-#include <cmath>     // for std::pow
+#include "CountTable.hpp"
+#include <stdexcept>
 #include <algorithm> // for std::reverse
+#include <iterator>  // for std::next
 
 /** ***************************************************************************
  * DFA constructor - initialize count and construct delta function
+ * @param  unknown: what M does with symbols outside Σ
  *
  *****************************************************************************/
 template<typename T>
-DFA<T>::DFA() {
+DFA<T>::DFA(UnknownSymbol unknown) : unknown(unknown) {
     delta.resize(1366, std::vector<int>(4));
     // vector that stores the count of strings accepted of length n,
     // initialized at n = 0, so count[0] through count[1364] = 1
     // since they're all accepting states, and count[1365] = 0 since it's dead state
-    count.resize(1366);
-    fill(count.begin(), count.end()-1, 1);
+    count = BigVector(1366);
+    for (int i = 0; i < 1365; i++)
+        count.assign(i, 1);
+
+    // symbols are numbered in the order of Σ, every other symbol gets the
+    // extra class
+    classes.assign(256, alphabet.size());
+    int index = 0;
+    for (auto &symbol: alphabet) {
+        auto code = static_cast<std::make_unsigned_t<T>>(symbol);
+        if (code < 256)
+            classes[code] = index++;
+        else
+            wideClasses[symbol] = index++;
+    }
 
     // transitions for each state depending on which letter is next
     for (int i = 0; i < delta.size(); i++)
         for (int j = 0; j < delta[i].size(); j++)
-            delta[i][j] = next_state(decode(i), char(j + 97));
+            delta[i][j] = next_state(decode(i), j);
+
+    // the same transitions letter by letter, successors[j * 1366 + i] is
+    // delta[i][j], the layout BigVector::gather_sum reads
+    successors.resize(delta.size() * 4);
+    for (size_t i = 0; i < delta.size(); i++)
+        for (size_t j = 0; j < 4; j++)
+            successors[j * delta.size() + i] = delta[i][j];
+
+    // the dead state stays dead whatever the policy for unknown symbols
+    table.resize(delta.size() * table_width());
+    for (int i = 0; i < STATES; i++) {
+        for (int j = 0; j < 4; j++)
+            table[i * table_width() + j] = delta[i][j];
+        int other = DEAD;
+        if (i != DEAD && unknown == UnknownSymbol::SKIP)
+            other = i;
+        else if (i != DEAD && unknown == UnknownSymbol::RESET)
+            other = START;
+        table[i * table_width() + 4] = other;
+    }
 }
 
 /** ***************************************************************************
@@ -45,52 +81,106 @@ DFA<T>::~DFA() = default;
 
 
 /** ***************************************************************************
- * map state buffers to integers from 0 to 1365
- * @param  state: string to encode
- * @pre    character exists in alphabet
- * @post   letter encoded, integer returned
+ * @return δ as a flat table of STATES rows of table_width() entries,
+ *  δ(q, σ) is at q * table_width() + symbol_class(σ)
+ *
+ *****************************************************************************/
+template<typename T>
+const int *DFA<T>::transition_table() const {
+    return table.data();
+}
+
+
+/** ***************************************************************************
+ * @return the number of symbol classes, |Σ| plus one for foreign symbols
+ *
+ *****************************************************************************/
+template<typename T>
+int DFA<T>::table_width() const {
+    return int(alphabet.size()) + 1;
+}
+
+
+/** ***************************************************************************
+ * @return the symbol class of each of the 256 byte values
  *
  *****************************************************************************/
 template<typename T>
-int DFA<T>::encode(const std::string& state) {
-    double intState = 0;
-    int exponent = int(state.size()-1);
+const unsigned char *DFA<T>::symbol_classes() const {
+    return classes.data();
+}
 
+
+/** ***************************************************************************
+ * @return the letter of Σ in a symbol class
+ * @pre    0 <= symbolClass < |Σ|
+ *
+ *****************************************************************************/
+template<typename T>
+T DFA<T>::letter(int symbolClass) const {
+    return *std::next(alphabet.begin(), symbolClass);
+}
+
+
+/** ***************************************************************************
+ * @return the symbol class of a symbol at or above code point 256
+ *
+ *****************************************************************************/
+template<typename T>
+int DFA<T>::wide_symbol_class(T symbol) const {
+    auto found = wideClasses.find(symbol);
+    return found == wideClasses.end() ? int(alphabet.size()) : found->second;
+}
+
+
+/** ***************************************************************************
+ * @return what M does with symbols outside Σ
+ *
+ *****************************************************************************/
+template<typename T>
+typename DFA<T>::UnknownSymbol DFA<T>::unknown_symbols() const {
+    return unknown;
+}
+
+
+/** ***************************************************************************
+ * map state buffers to integers from 0 to 1365
+ * @param  state: symbol classes to encode, oldest first
+ * @pre    every class is a letter, state.size() <= 5
+ * @post   the buffer read as a bijective base-4 number is returned
+ *
+ *****************************************************************************/
+template<typename T>
+int DFA<T>::encode(const Buffer& state) {
+    int intState = 0;
     for (auto &symbol: state)
-        intState += (symbol - 96) * std::pow(4, exponent--);
+        intState = intState * 4 + symbol + 1;
 
-    return int(intState);
+    return intState;
 }
 
 
 /** ***************************************************************************
- * decode a base-4 encoded string
+ * decode a base-4 encoded state buffer
  * @param  state: integer to decode
- * @pre    string has been encoded
- * @post   integer decoded, string returned
+ * @pre    state has been encoded
+ * @post   integer decoded, symbol classes returned oldest first
  *
  *****************************************************************************/
 template<typename T>
-std::string DFA<T>::decode(int state) {
-    std::string strState;
+typename DFA<T>::Buffer DFA<T>::decode(int state) {
+    Buffer buffer;
 
+    // digits run from 1 to 4 in bijective base 4, so take one off
+    // before dividing
     while (state > 0) {
-        // 96 is ascii for ` but 1 more is a, 2 more b, 3 more c 
-        char c = (state % 4) + 96;
-        // if letter is d it wants to print ` since 4 % 4 = 0 so 96 + 0 = 96
-        // so just make char = 100 which is ascii for 'd', and
-        // state-- bc state/=4 will be off by 1 in this case
-        if (c == 96) {
-            c = 100;
-            state--;
-        }
-
-        strState += c;
+        state--;
+        buffer.push_back(static_cast<unsigned char>(state % 4));
         state /= 4;
     }
 
-    std::reverse(strState.begin(), strState.end());
-    return strState;
+    std::reverse(buffer.begin(), buffer.end());
+    return buffer;
 }
 
 
@@ -98,14 +188,15 @@ std::string DFA<T>::decode(int state) {
  * accept as parameters a state buffer and input
  *  and return the next state buffer
  * @param  currentState: the current state buffer
- * @param  input: the input to be added to the state buffer
+ * @param  input: the symbol class of the letter to be added
  * @pre    currentState.size <= 5
  * @post   return next state
  *
  *****************************************************************************/
 template<typename T>
-int DFA<T>::next_state(const std::string& currentState, T input) {
-    std::string nextState = currentState + input;
+int DFA<T>::next_state(const Buffer& currentState, int input) {
+    Buffer nextState = currentState;
+    nextState.push_back(static_cast<unsigned char>(input));
 
     // dead state will always stay in dead state
     if (encode(currentState) == 1365)
@@ -115,8 +206,11 @@ int DFA<T>::next_state(const std::string& currentState, T input) {
     if (currentState.size() < 5)
         return encode(nextState);
 
-    return contains_every_letter(nextState) ?
-        encode(nextState.substr(1, nextState.size() - 1)) : 1365;
+    unsigned seen = 0;
+    for (auto &symbol: nextState)
+        seen |= 1u << symbol;
+    return seen == letter_mask() ?
+        encode(Buffer(nextState.begin() + 1, nextState.end())) : 1365;
 }
 
 
@@ -128,19 +222,25 @@ int DFA<T>::next_state(const std::string& currentState, T input) {
  *
  *****************************************************************************/
 template<typename T>
-bool DFA<T>::contains_every_letter(const std::string& str) {
-    int flag = 1; // count of unique symbols
+bool DFA<T>::contains_every_letter(const String& str) {
+    // one bit per symbol class; symbols outside Σ set the bit above the
+    // letters, which is not part of the full mask
+    unsigned seen = 0;
+    for (auto &symbol: str)
+        seen |= 1u << symbol_class(symbol);
 
-    std::string temp = str;
-    std::sort(temp.begin(), temp.end());
+    return (seen & letter_mask()) == letter_mask();
+}
 
-    // loop through the sorted string and count unique symbols
-    for (int i = 1; i < temp.size(); ++i)
-        if (temp[i] > temp[i-1]) flag++;
 
-    // if the count of unique symbols is equal to the size of the alphabet,
-    // return true, else return false
-    return flag == alphabet.size();
+/** ***************************************************************************
+ * @return the mask with one bit for every letter of Σ, bit i for the
+ *  symbol of class i
+ *
+ *****************************************************************************/
+template<typename T>
+unsigned DFA<T>::letter_mask() const {
+    return (1u << alphabet.size()) - 1;
 }
 
 
@@ -159,20 +259,176 @@ bool DFA<T>::contains_every_letter(const std::string& str) {
  *****************************************************************************/
 template<typename T>
 BigUnsigned DFA<T>::num_strings_accepted(int n) {
+    // the counts live in BigVector rows, which never take BigUnsigned
+    // storage, so the arena is not used here
+    BigVector previous(count.size());
+    for (int k = 0; k < n; k++) {
+        // every state's count becomes the sum of its successors' counts,
+        // one digit row at a time across all states
+        previous.swap(count);
+        count.gather_sum(previous, successors.data(), 4);
+    }
+
+    // count from state 0, the starting state, returned on the heap
+    return count.at(0);
+}
+
+
+/** ***************************************************************************
+ * compute the number of strings of length n accepted by M in a given
+ *  number type, starting from fresh counts
+ * @remark: Number is BigUnsigned or a FixedUnsigned wide enough for the
+ *  result; with FixedUnsigned (e.g. FixedCount for n <= FIXED_MAX_N) the
+ *  counts live inline in two vectors and the run does not allocate
+ *
+ * @param:  n: number of strings of length n
+ * @pre:    n >= 0
+ * @post:   return number of strings accepted of length n; throws
+ *          std::out_of_range if Number is FixedCount and n > FIXED_MAX_N,
+ *          or another FixedUnsigned too narrow for |Σ|^n
+ *
+ *****************************************************************************/
+template<typename T>
+template<typename Number>
+Number DFA<T>::num_strings_accepted_as(int n) {
+    if constexpr (std::is_same<Number, FixedCount>::value) {
+        if (n > FIXED_MAX_N)
+            throw std::out_of_range("DFA: FixedCount needs n <= FIXED_MAX_N");
+    }
+    else if constexpr (fixed_digits<Number>::value > 0) {
+        // |Σ|^n < 2^(n bits), with bits per letter rounded up
+        unsigned bits = 0;
+        while ((size_t(1) << bits) < alphabet.size())
+            bits++;
+        if (uint64_t(n) * bits >= fixed_digits<Number>::value)
+            throw std::out_of_range("DFA: count does not fit the fixed width");
+    }
+    BigArena::Scope scope(arena);
+
+    // count(q, 0) = 1 for the accepting states, 0 for the dead state
+    std::vector<Number> previous(delta.size());
+    std::vector<Number> current(delta.size(), Number(1));
+    current[1365] = Number(0);
+
     for (int k = 0; k < n; k++) {
-        std::vector<BigUnsigned> previous = count;
-        for (int i = 0; i < count.size(); i++) {
-            BigUnsigned nextCount;
-            for (int j = 0; j < 4; j++) {
-                int t_state = delta[i][j];
-                nextCount += previous[t_state];
-            }
-            count[i] = nextCount;
+        previous.swap(current);
+        for (size_t i = 0; i < delta.size(); i++) {
+            const std::vector<int> &row = delta[i];
+            Number nextCount = previous[row[0]];
+            for (size_t j = 1; j < row.size(); j++)
+                nextCount += previous[row[j]];
+            current[i] = nextCount;
         }
     }
 
-    // count from state 0, the starting state
-    return count[0];
+    // detach the result from the arena
+    BigArena::Scope heap(nullptr);
+    return Number(current[0]);
+}
+
+
+/** ***************************************************************************
+ * attach an arena that supplies BigUnsigned storage during counting runs
+ * @remark: only num_strings_accepted_as<BigUnsigned> allocates BigUnsigned
+ *  storage per step; num_strings_accepted keeps its counts in a BigVector
+ *  and FixedUnsigned counts are inline, so those runs ignore the arena
+ *
+ * @param  arena: the arena to use, or nullptr to use the heap
+ * @pre    arena outlives the runs it is attached to
+ * @post   results returned by the DFA never live in the arena
+ *
+ *****************************************************************************/
+template<typename T>
+void DFA<T>::set_arena(BigArena *arena) {
+    this->arena = arena;
+}
+
+/** ***************************************************************************
+ * get the number of strings of length n accepted from every state
+ * @remark: the counts are computed once, over the minimized δ, and kept
+ *  with those of every shorter length; asking again for any length up to
+ *  the longest one so far costs nothing
+ *
+ * @param  n: the length, n >= 0
+ * @post   return a view of count(q, n) for q = 0 .. STATES - 1; it stays
+ *         valid until release_counts() is called or the DFA is destroyed,
+ *         also across later calls
+ *
+ *****************************************************************************/
+template<typename T>
+CountView DFA<T>::count_vector(int n) {
+    if (n < 0)
+        throw std::invalid_argument("DFA::count_vector: negative length");
+    if (!counts) {
+        TransitionTable minimal = TransitionTable(*this).minimized(&stateClass);
+        counts.reset(new CountTable<BigUnsigned>(minimal, table_width() - 1));
+    }
+
+    // the kept counts must not live in an arena that may be reset
+    BigArena::Scope heap(nullptr);
+    counts->extend(n);
+    return CountView(counts->row(n), stateClass.data(), STATES, n);
+}
+
+
+/** ***************************************************************************
+ * release the counts kept by count_vector
+ * @post   every view returned before is invalid
+ *
+ *****************************************************************************/
+template<typename T>
+void DFA<T>::release_counts() {
+    counts.reset();
+    stateClass.clear();
+}
+
+
+/** ***************************************************************************
+ * CountView constructor
+ * @param  row: count(c, n) for every state c of the minimized δ
+ * @param  stateClass: the minimized state of every state
+ * @param  states: number of states
+ * @param  length: n
+ *
+ *****************************************************************************/
+CountView::CountView(const BigUnsigned *row, const int *stateClass, int states,
+                     int length)
+    : row(row), stateClass(stateClass), states(states), n(length) { }
+
+
+/** ***************************************************************************
+ * @return the number of states
+ *
+ *****************************************************************************/
+int CountView::size() const {
+    return states;
+}
+
+
+/** ***************************************************************************
+ * @return the length n of the strings counted
+ *
+ *****************************************************************************/
+int CountView::length() const {
+    return n;
+}
+
+
+/** ***************************************************************************
+ * @param  state: a state of the DFA, 0 <= state < size()
+ * @return the number of strings of length n accepted from state
+ *
+ *****************************************************************************/
+const BigUnsigned &CountView::operator [] (int state) const {
+    return row[stateClass[state]];
 }
 
-template class DFA<char>;
\ No newline at end of file
+template class DFA<char>;
+template DFA<char>::FixedCount DFA<char>::num_strings_accepted_as<DFA<char>::FixedCount>(int n);
+template BigUnsigned DFA<char>::num_strings_accepted_as<BigUnsigned>(int n);
+template class DFA<unsigned char>;
+template DFA<unsigned char>::FixedCount DFA<unsigned char>::num_strings_accepted_as<DFA<unsigned char>::FixedCount>(int n);
+template BigUnsigned DFA<unsigned char>::num_strings_accepted_as<BigUnsigned>(int n);
+template class DFA<char32_t>;
+template DFA<char32_t>::FixedCount DFA<char32_t>::num_strings_accepted_as<DFA<char32_t>::FixedCount>(int n);
+template BigUnsigned DFA<char32_t>::num_strings_accepted_as<BigUnsigned>(int n);
\ No newline at end of file
@@ -26,19 +26,85 @@
 
 
 #include "BigUnsigned.hpp"
+#include "BigVector.hpp"
+#include "FixedUnsigned.hpp"
+#include "SymbolView.hpp"
 #include <vector>
 #include <set>
+#include <map>
+#include <string>
+#include <memory>
+#include <type_traits>
+
+template<typename Number>
+class CountTable;
+
+// a read-only view of count(q, n), the number of strings of length n
+// accepted from q, for every state q of a DFA; see DFA::count_vector
+class CountView {
+public:
+    CountView(const BigUnsigned *row, const int *stateClass, int states,
+              int length);
+    int size() const;
+    int length() const;
+    const BigUnsigned &operator [] (int state) const;
+
+private:
+    // the counts are stored per state of the minimized δ
+    const BigUnsigned *row;
+    const int *stateClass;
+    int states;
+    int n;
+};
+
 template<typename T>
 class DFA {
 public:
-    explicit DFA();
+    // what M does with a symbol outside Σ: go to the dead state, ignore
+    // the symbol, or start over in q₀
+    enum class UnknownSymbol { REJECT, SKIP, RESET };
+
+    // strings of symbols and read-only views of them
+    typedef typename SymbolTypes<T>::String String;
+    typedef typename SymbolTypes<T>::View View;
+
+    explicit DFA(UnknownSymbol unknown = UnknownSymbol::REJECT);
     ~DFA();
-    bool contains_every_letter(const std::string& str);
+    bool contains_every_letter(const String& str);
     BigUnsigned num_strings_accepted(int n);
+    template<typename Number>
+    Number num_strings_accepted_as(int n);
+    void set_arena(BigArena *arena);
+    CountView count_vector(int n);
+    void release_counts();
+
+    // a count type that holds the result for every n <= FIXED_MAX_N
+    static constexpr int FIXED_MAX_N = 300;
+    typedef FixedUnsigned<2 * FIXED_MAX_N + 40> FixedCount;
+
+    // length of the substrings that must contain every letter
+    static constexpr int WINDOW = 6;
+
+    // Q = {0, ..., STATES - 1}, q₀ = START, F = Q - {DEAD}
+    static constexpr int STATES = 1366;
+    static constexpr int START = 0;
+    static constexpr int DEAD = 1365;
+
+    const int *transition_table() const;
+    int table_width() const;
+    const unsigned char *symbol_classes() const;
+    int symbol_class(T symbol) const;
+    T letter(int symbolClass) const;
+    unsigned letter_mask() const;
+    UnknownSymbol unknown_symbols() const;
 private:
-    int next_state(const std::string& currentState, T input);
-    int encode(const std::string& state);
-    static std::string decode(int state);
+    // a state buffer holds the symbol classes of the last letters read
+    typedef std::vector<unsigned char> Buffer;
+
+    int next_state(const Buffer& currentState, int input);
+    static int encode(const Buffer& state);
+    static Buffer decode(int state);
+    int wide_symbol_class(T symbol) const;
 
     // Σ(SIGMA): a finite alphabet represented as an array of length M that contains the input symbols
     std::set<T> alphabet {'a', 'b', 'c', 'd'};
@@ -46,10 +112,56 @@ private:
     // δ: transition function delta is a 2D vector of size N and M
     std::vector<std::vector<int>> delta;
 
+    // δ stored letter-major for the counting algorithm
+    std::vector<int> successors;
+
+    // δ as one flat table for running input through M: row q holds
+    // δ(q, σ) for every symbol class σ, where the last class stands for
+    // symbols outside Σ and leads where unknown says
+    std::vector<int> table;
+
+    // symbol class of every byte value, or of every code point below 256
+    // for wider symbol types
+    std::vector<unsigned char> classes;
+
+    // symbol class of the symbols of Σ at or above 256
+    std::map<T, unsigned char> wideClasses;
+
+    UnknownSymbol unknown;
+
+    // count of strings accepted from each state
+    BigVector count;
+
+    // arena for the BigUnsigned storage of num_strings_accepted_as runs,
+    // nullptr for the heap
+    BigArena *arena = nullptr;
 
-    std::vector<BigUnsigned> count;
+    // counts of every length asked for by count_vector, over the
+    // minimized δ, and the minimized state of every state
+    std::unique_ptr<CountTable<BigUnsigned>> counts;
+    std::vector<int> stateClass;
 
 };
 
 
+/** ***************************************************************************
+ * @return the symbol class of a symbol, its position in Σ or |Σ| if the
+ *  symbol is not in Σ
+ * @remark: defined here so that it inlines into the loops that run M; a
+ *  byte is one table lookup, wider symbols look up code points below 256
+ *  the same way
+ *
+ *****************************************************************************/
+template<typename T>
+inline int DFA<T>::symbol_class(T symbol) const {
+    if constexpr (sizeof(T) == 1) {
+        return classes[static_cast<unsigned char>(symbol)];
+    }
+    else {
+        auto code = static_cast<std::make_unsigned_t<T>>(symbol);
+        return code < 256 ? classes[code] : wide_symbol_class(symbol);
+    }
+}
+
+
 #endif //INC_454_P1_DFA_HPP
@@ -0,0 +1,213 @@
+/** ***************************************************************************
+ * @file:   Enumerator.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  Enumerator
+ *
+ *****************************************************************************/
+
+#include "Enumerator.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+// prefixes handed out per thread in the parallel version, so that threads
+// that get quick prefixes take more of them
+static const size_t PREFIXES_PER_THREAD = 8;
+
+
+/** ***************************************************************************
+ * Enumerator constructor
+ * @param  dfa: the DFA M
+ *
+ *****************************************************************************/
+template<typename T>
+Enumerator<T>::Enumerator(const DFA<T> &dfa)
+    : delta(TransitionTable(dfa).minimized()), symbols(dfa.table_width() - 1),
+      aliveLength(-1) {
+    for (int s = 0; s < symbols; s++)
+        letters.push_back(dfa.letter(s));
+}
+
+
+/** ***************************************************************************
+ * extend the alive table up to a length
+ * @post   alive(k, q) is known for every k <= n
+ *
+ *****************************************************************************/
+template<typename T>
+void Enumerator<T>::prepare(int n) {
+    // the rows up to aliveLength are kept; shrinking the table would lose
+    // them while aliveLength still claims them
+    if (n <= aliveLength)
+        return;
+    const int states = delta.states();
+    alive.resize(size_t(n + 1) * states);
+    for (int k = aliveLength + 1; k <= n; k++) {
+        uint8_t *row = alive.data() + size_t(k) * states;
+        for (int q = 0; q < states; q++) {
+            if (k == 0) {
+                row[q] = delta.accepting(q);
+                continue;
+            }
+            const uint8_t *previous = row - states;
+            uint8_t any = 0;
+            for (int s = 0; s < symbols; s++)
+                any |= previous[delta.next(q, s)];
+            row[q] = any;
+        }
+    }
+    aliveLength = n;
+}
+
+
+/** ***************************************************************************
+ * @return true if some string of length k is accepted from state
+ *
+ *****************************************************************************/
+template<typename T>
+bool Enumerator<T>::is_alive(int k, int state) const {
+    return alive[size_t(k) * delta.states() + state];
+}
+
+
+/** ***************************************************************************
+ * list the accepted strings of length n, in lexicographic order
+ * @param  n: the length, n >= 0
+ * @param  visit: called with every string
+ * @post   return the number of strings listed
+ *
+ *****************************************************************************/
+template<typename T>
+uint64_t Enumerator<T>::enumerate(int n, const Callback &visit) {
+    if (n < 0)
+        throw std::invalid_argument("Enumerator: negative length");
+    prepare(n);
+    std::vector<T> buffer(n);
+    return complete(n, 0, delta.start(), buffer.data(), visit);
+}
+
+
+/** ***************************************************************************
+ * list the accepted strings of length n using several threads
+ * @param  n: the length, n >= 0
+ * @param  visit: called with every string, from all threads at once; it
+ *         must be safe to call concurrently and must not throw
+ * @param  threads: number of threads, 0 for one per hardware thread
+ * @post   return the number of strings listed
+ *
+ *****************************************************************************/
+template<typename T>
+uint64_t Enumerator<T>::enumerate_parallel(int n, const Callback &visit,
+                                           unsigned threads) {
+    if (n < 0)
+        throw std::invalid_argument("Enumerator: negative length");
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+    if (threads == 0)
+        threads = 1;
+    prepare(n);
+
+    // the shortest prefix length that gives every thread several prefixes
+    int length = 0;
+    size_t prefixes = 1;
+    while (length < n && prefixes < PREFIXES_PER_THREAD * threads) {
+        prefixes *= symbols;
+        length++;
+    }
+
+    std::atomic<size_t> nextPrefix(0);
+    std::vector<uint64_t> found(threads, 0);
+    auto work = [&](unsigned id) {
+        std::vector<T> buffer(n);
+        std::vector<int> prefix(length);
+        for (size_t p = nextPrefix++; p < prefixes; p = nextPrefix++) {
+            // prefix p written in base |Σ|, most significant letter first
+            size_t rest = p;
+            for (int i = length - 1; i >= 0; i--) {
+                prefix[i] = int(rest % symbols);
+                buffer[i] = letters[prefix[i]];
+                rest /= symbols;
+            }
+            int q = delta.start();
+            bool live = true;
+            for (int i = 0; i < length && live; i++) {
+                q = delta.next(q, prefix[i]);
+                live = is_alive(n - i - 1, q);
+            }
+            if (live)
+                found[id] += complete(n, length, q, buffer.data(), visit);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned id = 1; id < threads; id++)
+        workers.emplace_back(work, id);
+    work(0);
+    for (std::thread &worker : workers)
+        worker.join();
+
+    uint64_t total = 0;
+    for (uint64_t count : found)
+        total += count;
+    return total;
+}
+
+
+/** ***************************************************************************
+ * list the accepted completions of a prefix
+ * @param  n: the length of the strings
+ * @param  depth: the length of the prefix, already in buffer[0 .. depth)
+ * @param  state: the state reached on the prefix
+ * @param  buffer: room for n symbols
+ * @param  visit: called with every string
+ * @post   return the number of strings listed
+ *
+ *****************************************************************************/
+template<typename T>
+uint64_t Enumerator<T>::complete(int n, int depth, int state, T *buffer,
+                                 const Callback &visit) const {
+    if (!is_alive(n - depth, state))
+        return 0;
+    if (depth == n) {
+        visit(View(buffer, n));
+        return 1;
+    }
+
+    // an explicit stack of the state and the next letter to try per depth
+    std::vector<int> states(n + 1);
+    std::vector<int> tried(n + 1);
+    const int *table = delta.data();
+    const int width = delta.width();
+    const int count = delta.states();
+    uint64_t listed = 0;
+
+    int d = depth;
+    states[d] = state;
+    tried[d] = 0;
+    while (d >= depth) {
+        if (tried[d] == symbols) {
+            d--;
+            continue;
+        }
+        int s = tried[d]++;
+        int next = table[states[d] * width + s];
+        if (!alive[size_t(n - d - 1) * count + next])
+            continue;
+        buffer[d] = letters[s];
+        if (d + 1 == n) {
+            visit(View(buffer, n));
+            listed++;
+            continue;
+        }
+        d++;
+        states[d] = next;
+        tried[d] = 0;
+    }
+    return listed;
+}
+
+template class Enumerator<char>;
+template class Enumerator<unsigned char>;
+template class Enumerator<char32_t>;
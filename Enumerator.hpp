@@ -0,0 +1,62 @@
+/** ***************************************************************************
+ * @file:   Enumerator.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called Enumerator
+ * @remark: An Enumerator lists every string of length n accepted by M, in
+ *  lexicographic order, by a depth-first search over the minimized δ.
+ *  A table alive(k, q), true when some string of length k is accepted
+ *  from q, prunes every branch that cannot be completed, the dead state
+ *  included, so the search never backtracks out of a dead end and its
+ *  cost is proportional to the output. All strings are built in one
+ *  buffer and handed to a callback as a view that is valid during
+ *  the call; nothing is allocated per string.
+ *
+ *  The parallel version splits the strings by a short prefix and lets a
+ *  pool of threads take the prefixes in turn. Each thread lists its
+ *  prefixes in order, but the callback is called from all threads at once
+ *  and the strings of different prefixes interleave.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_ENUMERATOR_HPP
+#define INC_454_P1_ENUMERATOR_HPP
+
+
+#include "DFA.hpp"
+#include "TransitionTable.hpp"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+template<typename T>
+class Enumerator {
+public:
+    typedef typename DFA<T>::View View;
+    typedef std::function<void(View word)> Callback;
+
+    explicit Enumerator(const DFA<T> &dfa);
+    uint64_t enumerate(int n, const Callback &visit);
+    uint64_t enumerate_parallel(int n, const Callback &visit,
+                                unsigned threads = 0);
+
+private:
+    void prepare(int n);
+    bool is_alive(int k, int state) const;
+    uint64_t complete(int n, int depth, int state, T *buffer,
+                      const Callback &visit) const;
+
+    // the minimized δ
+    TransitionTable delta;
+    int symbols;
+
+    // the letter of each symbol class
+    std::vector<T> letters;
+
+    // alive[k * states + q] for k = 0 .. aliveLength
+    std::vector<uint8_t> alive;
+    int aliveLength;
+};
+
+
+#endif //INC_454_P1_ENUMERATOR_HPP
@@ -0,0 +1,422 @@
+/** ***************************************************************************
+ * @file:   FixedUnsigned.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the class template FixedUnsigned
+ * @remark: FixedUnsigned<Bits> holds an unsigned integer of at most Bits
+ *  bits with the same interface as BigUnsigned. The limbs live inside the
+ *  object, so values never allocate and every loop runs over a length
+ *  known at compile time. Bits is rounded up to whole 64-bit limbs, and
+ *  arithmetic is modulo 2^DIGITS, DIGITS = 64 LIMBS: the caller picks Bits
+ *  large enough for every value it produces, e.g. 640 bits for the counts
+ *  of strings of length n <= 300 over four letters (4^300 = 2^600).
+ *  fixed_digits<Number> gives DIGITS for a FixedUnsigned and 0 for number
+ *  types that do not wrap around, so generic code can check its bounds.
+ *
+ *  The members are defined in this header so that the additions inline
+ *  into the loops that use them.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_FIXEDUNSIGNED_HPP
+#define INC_454_P1_FIXEDUNSIGNED_HPP
+
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <type_traits>
+
+template<unsigned Bits>
+class FixedUnsigned {
+public:
+    static const unsigned LIMBS = (Bits + 63) / 64;
+
+    // number of bits held, as std::numeric_limits<T>::digits; values
+    // wrap around modulo 2^DIGITS
+    static const unsigned DIGITS = 64 * LIMBS;
+
+    FixedUnsigned();
+    FixedUnsigned(unsigned V);
+    explicit FixedUnsigned(std::string_view str);
+    size_t length() const;
+    FixedUnsigned operator + (const FixedUnsigned &other) const;
+    FixedUnsigned &operator += (const FixedUnsigned &other);
+    FixedUnsigned operator - (const FixedUnsigned &other) const;
+    FixedUnsigned &operator -= (const FixedUnsigned &other);
+    FixedUnsigned operator * (const FixedUnsigned &other) const;
+    bool operator == (const FixedUnsigned &other) const;
+    bool operator < (const FixedUnsigned &other) const;
+    std::string to_string() const;
+    double to_double() const;
+
+    template<typename Generator>
+    static FixedUnsigned uniform_below(const FixedUnsigned &bound, Generator &random);
+
+    template<unsigned B>
+    friend std::ostream &operator << (std::ostream &outs, const FixedUnsigned<B> &FU);
+    template<unsigned B>
+    friend std::istream &operator >> (std::istream &ins, FixedUnsigned<B> &FU);
+
+private:
+    void multiply_add(uint32_t factor, uint32_t addend);
+    uint32_t divide(uint32_t divisor);
+    bool is_zero() const;
+
+    // little-endian limbs, limb[0] is the least significant
+    uint64_t limb[LIMBS];
+};
+
+// DIGITS of a FixedUnsigned, 0 for a number type that does not wrap around
+template<typename Number>
+struct fixed_digits : std::integral_constant<unsigned, 0> { };
+
+template<unsigned Bits>
+struct fixed_digits<FixedUnsigned<Bits>>
+    : std::integral_constant<unsigned, FixedUnsigned<Bits>::DIGITS> { };
+
+
+/** ***************************************************************************
+ * FixedUnsigned constructor - initialize to 0
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+FixedUnsigned<Bits>::FixedUnsigned() {
+    std::fill(limb, limb + LIMBS, 0);
+}
+
+
+/** ***************************************************************************
+ * FixedUnsigned constructor - initialize to an unsigned value
+ * @param  V: the value
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+FixedUnsigned<Bits>::FixedUnsigned(unsigned V) {
+    std::fill(limb, limb + LIMBS, 0);
+    limb[0] = V;
+}
+
+
+/** ***************************************************************************
+ * FixedUnsigned constructor - parse leading white space and decimal digits
+ * @param  str: the text to parse, 0 if it holds no digits
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+FixedUnsigned<Bits>::FixedUnsigned(std::string_view str) {
+    std::fill(limb, limb + LIMBS, 0);
+    size_t i = 0;
+    while (i < str.size() && isspace (static_cast<unsigned char>(str[i])))
+        i++;
+
+    // take up to nine digits per step
+    while (i < str.size() && isdigit (static_cast<unsigned char>(str[i]))) {
+        uint32_t chunk = 0;
+        uint32_t scale = 1;
+        for (int k = 0; k < 9 && i < str.size()
+                        && isdigit (static_cast<unsigned char>(str[i])); k++) {
+            chunk = chunk * 10 + (str[i++] - '0');
+            scale *= 10;
+        }
+        multiply_add(scale, chunk);
+    }
+}
+
+
+/** ***************************************************************************
+ * @return the number of decimal digits, as BigUnsigned::length
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+size_t FixedUnsigned<Bits>::length() const {
+    return to_string().size();
+}
+
+
+/** ***************************************************************************
+ * @return the sum of *this and other, modulo 2^DIGITS
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+FixedUnsigned<Bits> FixedUnsigned<Bits>::operator + (const FixedUnsigned &other) const {
+    FixedUnsigned sum = *this;
+    sum += other;
+    return sum;
+}
+
+
+/** ***************************************************************************
+ * add other to *this, modulo 2^DIGITS
+ * @return *this
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+FixedUnsigned<Bits> &FixedUnsigned<Bits>::operator += (const FixedUnsigned &other) {
+    uint64_t carry = 0;
+    for (unsigned i = 0; i < LIMBS; i++) {
+        uint64_t s = limb[i] + carry;
+        carry = s < carry;
+        s += other.limb[i];
+        carry += s < other.limb[i];
+        limb[i] = s;
+    }
+    return *this;
+}
+
+
+/** ***************************************************************************
+ * @return the difference of *this and other, modulo 2^DIGITS
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+FixedUnsigned<Bits> FixedUnsigned<Bits>::operator - (const FixedUnsigned &other) const {
+    FixedUnsigned difference = *this;
+    difference -= other;
+    return difference;
+}
+
+
+/** ***************************************************************************
+ * subtract other from *this, modulo 2^DIGITS
+ * @return *this
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+FixedUnsigned<Bits> &FixedUnsigned<Bits>::operator -= (const FixedUnsigned &other) {
+    uint64_t borrow = 0;
+    for (unsigned i = 0; i < LIMBS; i++) {
+        uint64_t d = limb[i] - borrow;
+        borrow = d > limb[i];
+        borrow += d < other.limb[i];
+        limb[i] = d - other.limb[i];
+    }
+    return *this;
+}
+
+
+/** ***************************************************************************
+ * @return the product of *this and other, modulo 2^DIGITS
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+FixedUnsigned<Bits> FixedUnsigned<Bits>::operator * (const FixedUnsigned &other) const {
+    // schoolbook multiplication on 32-bit halves so that every partial
+    // product fits in 64 bits
+    const unsigned HALVES = 2 * LIMBS;
+    uint32_t a[HALVES], b[HALVES];
+    uint32_t p[HALVES] = {};
+    for (unsigned i = 0; i < LIMBS; i++) {
+        a[2 * i] = uint32_t(limb[i]);
+        a[2 * i + 1] = uint32_t(limb[i] >> 32);
+        b[2 * i] = uint32_t(other.limb[i]);
+        b[2 * i + 1] = uint32_t(other.limb[i] >> 32);
+    }
+    for (unsigned i = 0; i < HALVES; i++) {
+        uint64_t carry = 0;
+        for (unsigned j = 0; i + j < HALVES; j++) {
+            uint64_t t = uint64_t(a[i]) * b[j] + p[i + j] + carry;
+            p[i + j] = uint32_t(t);
+            carry = t >> 32;
+        }
+    }
+
+    FixedUnsigned product;
+    for (unsigned i = 0; i < LIMBS; i++)
+        product.limb[i] = uint64_t(p[2 * i]) | uint64_t(p[2 * i + 1]) << 32;
+    return product;
+}
+
+
+/** ***************************************************************************
+ * @return true if both values are equal
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+bool FixedUnsigned<Bits>::operator == (const FixedUnsigned &other) const {
+    for (unsigned i = 0; i < LIMBS; i++)
+        if (limb[i] != other.limb[i])
+            return false;
+    return true;
+}
+
+
+/** ***************************************************************************
+ * @return true if *this is smaller than other
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+bool FixedUnsigned<Bits>::operator < (const FixedUnsigned &other) const {
+    for (unsigned i = LIMBS; i-- > 0; )
+        if (limb[i] != other.limb[i])
+            return limb[i] < other.limb[i];
+    return false;
+}
+
+
+/** ***************************************************************************
+ * set *this to *this * factor + addend, modulo 2^DIGITS
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+void FixedUnsigned<Bits>::multiply_add(uint32_t factor, uint32_t addend) {
+    uint64_t carry = addend;
+    for (unsigned i = 0; i < LIMBS; i++) {
+        uint64_t low = (limb[i] & 0xFFFFFFFFu) * factor + carry;
+        uint64_t high = (limb[i] >> 32) * factor + (low >> 32);
+        limb[i] = (low & 0xFFFFFFFFu) | (high << 32);
+        carry = high >> 32;
+    }
+}
+
+
+/** ***************************************************************************
+ * divide *this by a divisor in place
+ * @return the remainder
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+uint32_t FixedUnsigned<Bits>::divide(uint32_t divisor) {
+    uint64_t rem = 0;
+    for (unsigned i = LIMBS; i-- > 0; ) {
+        uint64_t high = (rem << 32) | (limb[i] >> 32);
+        uint64_t qHigh = high / divisor;
+        rem = high % divisor;
+        uint64_t low = (rem << 32) | (limb[i] & 0xFFFFFFFFu);
+        uint64_t qLow = low / divisor;
+        rem = low % divisor;
+        limb[i] = (qHigh << 32) | qLow;
+    }
+    return uint32_t(rem);
+}
+
+
+/** ***************************************************************************
+ * @return true if the value is 0
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+bool FixedUnsigned<Bits>::is_zero() const {
+    for (unsigned i = 0; i < LIMBS; i++)
+        if (limb[i] != 0)
+            return false;
+    return true;
+}
+
+
+/** ***************************************************************************
+ * @return the value in decimal
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+std::string FixedUnsigned<Bits>::to_string() const {
+    FixedUnsigned rest = *this;
+    std::string digits;
+    // peel off nine digits at a time, least significant first
+    do {
+        uint32_t chunk = rest.divide(1000000000u);
+        for (int k = 0; k < 9; k++) {
+            digits += char('0' + chunk % 10);
+            chunk /= 10;
+        }
+    } while (!rest.is_zero());
+
+    while (digits.size() > 1 && digits.back() == '0')
+        digits.pop_back();
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+
+/** ***************************************************************************
+ * @return the value rounded to a double, infinity if it is too large
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+double FixedUnsigned<Bits>::to_double() const {
+    double value = 0;
+    for (unsigned i = LIMBS; i-- > 0; )
+        value = value * 18446744073709551616.0 + double(limb[i]);
+    return value;
+}
+
+
+/** ***************************************************************************
+ * draw a value uniformly at random
+ * @param  bound: the number of possible values, must not be 0
+ * @param  random: a generator whose call operator returns 64 random bits
+ * @post   return a value from 0 to bound - 1; values at or above bound are
+ *         redrawn, which happens less than half the time
+ *
+ *****************************************************************************/
+template<unsigned Bits>
+template<typename Generator>
+FixedUnsigned<Bits> FixedUnsigned<Bits>::uniform_below(const FixedUnsigned &bound,
+                                                       Generator &random) {
+    unsigned top = LIMBS - 1;
+    while (top > 0 && bound.limb[top] == 0)
+        top--;
+    // keep the bits of the top limb up to the highest bit of the bound
+    uint64_t mask = bound.limb[top];
+    mask |= mask >> 1;
+    mask |= mask >> 2;
+    mask |= mask >> 4;
+    mask |= mask >> 8;
+    mask |= mask >> 16;
+    mask |= mask >> 32;
+
+    FixedUnsigned value;
+    do {
+        for (unsigned i = 0; i < top; i++)
+            value.limb[i] = random();
+        value.limb[top] = random() & mask;
+    } while (!(value < bound));
+    return value;
+}
+
+
+/** ***************************************************************************
+ * write the value in decimal to an output stream
+ *
+ *****************************************************************************/
+template<unsigned B>
+std::ostream &operator << (std::ostream &outs, const FixedUnsigned<B> &FU) {
+    outs << FU.to_string();
+    return outs;
+}
+
+
+/** ***************************************************************************
+ * read a decimal value from an input stream, as the BigUnsigned extraction
+ * operator: leading white space is skipped and the stream fails if no
+ * digit is found
+ *
+ *****************************************************************************/
+template<unsigned B>
+std::istream &operator >> (std::istream &ins, FixedUnsigned<B> &FU) {
+    std::istream::sentry sentry(ins);
+    if (!sentry)
+        return ins;
+
+    std::streambuf *buf = ins.rdbuf();
+    const int eof = std::char_traits<char>::eof();
+    FixedUnsigned<B> value;
+    bool found = false;
+    int c = buf->sgetc();
+    while (c != eof && isdigit (c)) {
+        value.multiply_add(10, uint32_t(c - '0'));
+        found = true;
+        c = buf->snextc();
+    }
+    if (c == eof)
+        ins.setstate (std::ios::eofbit);
+    if (!found)
+        ins.setstate (std::ios::failbit);
+    FU = value;
+    return ins;
+}
+
+
+#endif //INC_454_P1_FIXEDUNSIGNED_HPP
@@ -0,0 +1,150 @@
+/** ***************************************************************************
+ * @file:   FrequencyCounter.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  FrequencyCounter. The polynomials of all states are kept in one flat
+ *  array, n + 1 coefficients per state, and after k steps only the
+ *  coefficients 0 .. k can be nonzero.
+ *
+ *****************************************************************************/
+
+#include "FrequencyCounter.hpp"
+#include <stdexcept>
+#include <type_traits>
+
+
+/** ***************************************************************************
+ * FrequencyCounter constructor
+ * @param  dfa: the DFA M, must outlive the counter
+ *
+ *****************************************************************************/
+template<typename T>
+FrequencyCounter<T>::FrequencyCounter(const DFA<T> &dfa)
+    : dfa(dfa), delta(TransitionTable(dfa).minimized()),
+      symbols(dfa.table_width() - 1) { }
+
+
+/** ***************************************************************************
+ * count the accepted strings by the number of occurrences of a letter
+ * @param  n: the length, n >= 0
+ * @param  symbol: the letter x, which must be in Σ
+ * @post   return n + 1 counts, count j is the number of strings of length n
+ *         accepted by M in which x occurs j times
+ *
+ *****************************************************************************/
+template<typename T>
+template<typename Number>
+std::vector<Number> FrequencyCounter<T>::distribution(int n, T symbol) const {
+    if (std::is_same<Number, typename DFA<T>::FixedCount>::value && n > DFA<T>::FIXED_MAX_N)
+        throw std::out_of_range("FrequencyCounter: FixedCount needs n <= FIXED_MAX_N");
+    return run<Number>(n, symbol, [](Number &sum, const Number *const *terms,
+                                     size_t count) {
+        if constexpr (std::is_same<Number, BigUnsigned>::value) {
+            BigUnsigned::add_all(sum, terms, count);
+        }
+        else {
+            sum = count > 0 ? *terms[0] : Number(0);
+            for (size_t t = 1; t < count; t++)
+                sum += *terms[t];
+        }
+    });
+}
+
+
+/** ***************************************************************************
+ * count the accepted strings by the number of occurrences of a letter,
+ *  modulo a number
+ * @param  n: the length, n >= 0
+ * @param  symbol: the letter x, which must be in Σ
+ * @param  modulus: the modulus, 1 <= modulus <= 2^63
+ * @post   return the counts of distribution, each modulo modulus
+ *
+ *****************************************************************************/
+template<typename T>
+std::vector<uint64_t> FrequencyCounter<T>::distribution_mod(int n, T symbol,
+                                                            uint64_t modulus) const {
+    if (modulus == 0 || modulus > (uint64_t(1) << 63))
+        throw std::invalid_argument("FrequencyCounter: modulus out of range");
+    std::vector<uint64_t> counts = run<uint64_t>(n, symbol,
+        [modulus](uint64_t &sum, const uint64_t *const *terms, size_t count) {
+            sum = 0;
+            for (size_t t = 0; t < count; t++) {
+                sum += *terms[t];
+                if (sum >= modulus)
+                    sum -= modulus;
+            }
+        });
+    // the first row holds 1s, which are 0 modulo 1
+    for (uint64_t &count : counts)
+        count %= modulus;
+    return counts;
+}
+
+
+/** ***************************************************************************
+ * run the polynomial DP
+ * @param  n: the length
+ * @param  symbol: the letter x
+ * @param  sum: sets its first argument to the sum of the count terms its
+ *         second argument points to
+ * @post   return the coefficients of P(q₀, n)
+ *
+ *****************************************************************************/
+template<typename T>
+template<typename Number, typename Sum>
+std::vector<Number> FrequencyCounter<T>::run(int n, T symbol, const Sum &sum) const {
+    if (n < 0)
+        throw std::invalid_argument("FrequencyCounter: negative length");
+    const int marked = dfa.symbol_class(symbol);
+    if (marked >= symbols)
+        throw std::invalid_argument("FrequencyCounter: symbol outside Σ");
+
+    const int states = delta.states();
+    const size_t stride = size_t(n) + 1;
+    std::vector<Number> previous(states * stride, Number(0));
+    std::vector<Number> current(states * stride, Number(0));
+    for (int q = 0; q < states; q++)
+        current[q * stride] = Number(delta.accepting(q) ? 1 : 0);
+
+    std::vector<const Number *> rows(symbols);
+    std::vector<const Number *> terms(symbols);
+    for (int k = 1; k <= n; k++) {
+        previous.swap(current);
+        for (int q = 0; q < states; q++) {
+            for (int s = 0; s < symbols; s++)
+                rows[s] = previous.data() + delta.next(q, s) * stride;
+
+            // coefficient j takes coefficient j of P(δ(q, σ), k - 1) for
+            // σ ≠ x and coefficient j - 1 of P(δ(q, x), k - 1), the shift
+            // by z; coefficient k - 1 is the highest nonzero one there
+            Number *out = current.data() + q * stride;
+            for (int j = 0; j <= k; j++) {
+                size_t count = 0;
+                for (int s = 0; s < symbols; s++) {
+                    if (s == marked) {
+                        if (j > 0)
+                            terms[count++] = rows[s] + j - 1;
+                    }
+                    else if (j < k) {
+                        terms[count++] = rows[s] + j;
+                    }
+                }
+                sum(out[j], terms.data(), count);
+            }
+        }
+    }
+
+    const Number *start = current.data() + delta.start() * stride;
+    return std::vector<Number>(start, start + stride);
+}
+
+template class FrequencyCounter<char>;
+template class FrequencyCounter<unsigned char>;
+template class FrequencyCounter<char32_t>;
+template std::vector<BigUnsigned> FrequencyCounter<char>::distribution<BigUnsigned>(int n, char symbol) const;
+template std::vector<DFA<char>::FixedCount> FrequencyCounter<char>::distribution<DFA<char>::FixedCount>(int n, char symbol) const;
+template std::vector<BigUnsigned> FrequencyCounter<unsigned char>::distribution<BigUnsigned>(int n, unsigned char symbol) const;
+template std::vector<DFA<unsigned char>::FixedCount> FrequencyCounter<unsigned char>::distribution<DFA<unsigned char>::FixedCount>(int n, unsigned char symbol) const;
+template std::vector<BigUnsigned> FrequencyCounter<char32_t>::distribution<BigUnsigned>(int n, char32_t symbol) const;
+template std::vector<DFA<char32_t>::FixedCount> FrequencyCounter<char32_t>::distribution<DFA<char32_t>::FixedCount>(int n, char32_t symbol) const;
@@ -0,0 +1,50 @@
+/** ***************************************************************************
+ * @file:   FrequencyCounter.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called
+ *  FrequencyCounter
+ * @remark: A FrequencyCounter splits the number of strings of length n
+ *  accepted by M by how often one chosen letter x occurs in them. Every
+ *  cell of the counting DP becomes a polynomial whose coefficient j
+ *  counts the strings with j occurrences of x:
+ *      P(q, 0) = 1 if q ∈ F, else 0
+ *      P(q, k) = z P(δ(q, x), k - 1) + Σ over letters σ ≠ x of P(δ(q, σ), k - 1)
+ *  Multiplying by z only shifts the coefficients by one, so a step needs
+ *  additions only and the whole distribution comes out of one run of
+ *  O(n² |Q|) additions over the minimized δ. The coefficients are
+ *  BigUnsigned, FixedCount (n <= FIXED_MAX_N), or residues modulo a
+ *  64-bit number.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_FREQUENCYCOUNTER_HPP
+#define INC_454_P1_FREQUENCYCOUNTER_HPP
+
+
+#include "DFA.hpp"
+#include "TransitionTable.hpp"
+#include <cstdint>
+#include <vector>
+
+template<typename T>
+class FrequencyCounter {
+public:
+    explicit FrequencyCounter(const DFA<T> &dfa);
+    template<typename Number>
+    std::vector<Number> distribution(int n, T symbol) const;
+    std::vector<uint64_t> distribution_mod(int n, T symbol, uint64_t modulus) const;
+
+private:
+    template<typename Number, typename Sum>
+    std::vector<Number> run(int n, T symbol, const Sum &sum) const;
+
+    const DFA<T> &dfa;
+
+    // the minimized δ
+    TransitionTable delta;
+    int symbols;
+};
+
+
+#endif //INC_454_P1_FREQUENCYCOUNTER_HPP
@@ -0,0 +1,225 @@
+/** ***************************************************************************
+ * @file:   HammingNeighborhood.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class template
+ *  called HammingNeighborhood. A map is stored densely, one byte per
+ *  state of the minimized δ with d + 1 standing for "not reachable", and
+ *  the maps built so far are numbered through a std::map. The column of
+ *  symbols outside Σ is treated like a letter: changing such a symbol
+ *  costs 1, and so does changing a letter into one.
+ *
+ *****************************************************************************/
+
+#include "HammingNeighborhood.hpp"
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+
+/** ***************************************************************************
+ * HammingNeighborhood constructor - build the DFA of N_d(L)
+ * @param  dfa: the DFA M, must outlive the neighborhood
+ * @param  distance: the distance d, 0 <= d <= MAX_DISTANCE
+ * @param  maxStates: the most maps the construction may build
+ *
+ *****************************************************************************/
+template<typename T>
+HammingNeighborhood<T>::HammingNeighborhood(const DFA<T> &dfa, int distance,
+                                            int maxStates)
+    : dfa(dfa), radius(distance), maps(0),
+      counts(build(TransitionTable(dfa).minimized(), distance, maxStates, maps),
+             dfa.table_width() - 1) { }
+
+
+/** ***************************************************************************
+ * @return the distance d
+ *
+ *****************************************************************************/
+template<typename T>
+int HammingNeighborhood<T>::distance() const {
+    return radius;
+}
+
+
+/** ***************************************************************************
+ * @return the number of maps the construction built before minimizing
+ *
+ *****************************************************************************/
+template<typename T>
+int HammingNeighborhood<T>::explored() const {
+    return maps;
+}
+
+
+/** ***************************************************************************
+ * @return the minimized DFA of N_d(L), over the symbol classes of M
+ *
+ *****************************************************************************/
+template<typename T>
+const TransitionTable &HammingNeighborhood<T>::automaton() const {
+    return counts.transitions();
+}
+
+
+/** ***************************************************************************
+ * check whether a string is within distance d of L
+ * @param  input: the string
+ * @post   return true if changing at most d symbols of input can give a
+ *         string accepted by M
+ *
+ *****************************************************************************/
+template<typename T>
+bool HammingNeighborhood<T>::within(const String &input) const {
+    const TransitionTable &neighborhood = counts.transitions();
+    int q = neighborhood.start();
+    for (T symbol : input)
+        q = neighborhood.next(q, dfa.symbol_class(symbol));
+    return neighborhood.accepting(q);
+}
+
+
+/** ***************************************************************************
+ * @param  n: the length, n >= 0
+ * @return the number of strings of n letters within distance d of L
+ *
+ *****************************************************************************/
+template<typename T>
+BigUnsigned HammingNeighborhood<T>::count(int n) {
+    if (n < 0)
+        throw std::invalid_argument("HammingNeighborhood: negative length");
+    counts.extend(n);
+    return counts.row(n)[counts.transitions().start()];
+}
+
+
+/** ***************************************************************************
+ * build the reachable maps and minimize them
+ * @param  delta: the minimized δ
+ * @param  distance: the distance d
+ * @param  maxStates: the most maps to build
+ * @param  explored: set to the number of maps built
+ * @post   return the minimized DFA of N_d(L)
+ *
+ *****************************************************************************/
+template<typename T>
+TransitionTable HammingNeighborhood<T>::build(const TransitionTable &delta,
+                                              int distance, int maxStates,
+                                              int &explored) {
+    if (distance < 0 || distance > MAX_DISTANCE)
+        throw std::invalid_argument("HammingNeighborhood: distance out of range");
+    const int states = delta.states();
+    const int width = delta.width();
+    const unsigned char far = static_cast<unsigned char>(distance + 1);
+
+    // covered[q * states + p]: every string accepted from q is accepted
+    // from p, the largest relation with q ∈ F ⇒ p ∈ F that is kept by
+    // every transition
+    std::vector<bool> covered(size_t(states) * states);
+    for (int q = 0; q < states; q++)
+        for (int p = 0; p < states; p++)
+            covered[size_t(q) * states + p] = !delta.accepting(q) || delta.accepting(p);
+    for (bool changed = true; changed; ) {
+        changed = false;
+        for (int q = 0; q < states; q++) {
+            for (int p = 0; p < states; p++) {
+                if (!covered[size_t(q) * states + p])
+                    continue;
+                for (int s = 0; s < width; s++) {
+                    if (!covered[size_t(delta.next(q, s)) * states + delta.next(p, s)]) {
+                        covered[size_t(q) * states + p] = false;
+                        changed = true;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // live[q]: F can be reached from q
+    std::vector<bool> live(states, false);
+    for (int q = 0; q < states; q++)
+        live[q] = delta.accepting(q);
+    for (bool changed = true; changed; ) {
+        changed = false;
+        for (int q = 0; q < states; q++) {
+            for (int s = 0; s < width && !live[q]; s++) {
+                if (live[delta.next(q, s)]) {
+                    live[q] = true;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    typedef std::vector<unsigned char> Map;
+    std::map<Map, int> index;
+    std::vector<Map> found;
+    auto add = [&](const Map &map) {
+        auto entry = index.find(map);
+        if (entry != index.end())
+            return entry->second;
+        if (int(found.size()) >= maxStates)
+            throw std::length_error("HammingNeighborhood: too many states");
+        index.emplace(map, int(found.size()));
+        found.push_back(map);
+        return int(found.size()) - 1;
+    };
+
+    Map first(states, far);
+    if (live[delta.start()])
+        first[delta.start()] = 0;
+    add(first);
+
+    std::vector<int> next;
+    std::vector<bool> accepting;
+    Map image;
+    std::vector<int> reached;
+    // found grows while it is walked, which makes this a breadth-first
+    // search over the reachable maps
+    for (size_t i = 0; i < found.size(); i++) {
+        bool accepts = false;
+        for (int q = 0; q < states; q++)
+            if (found[i][q] < far && delta.accepting(q))
+                accepts = true;
+        accepting.push_back(accepts);
+
+        for (int s = 0; s < width; s++) {
+            image.assign(states, far);
+            for (int q = 0; q < states; q++) {
+                const unsigned char e = found[i][q];
+                if (e == far)
+                    continue;
+                for (int t = 0; t < width; t++) {
+                    const int p = delta.next(q, t);
+                    const unsigned char cost = e + (t != s);
+                    if (live[p] && cost < image[p])
+                        image[p] = cost;
+                }
+            }
+            // q adds nothing to the map when some p reached with no more
+            // changes accepts all it does
+            reached.clear();
+            for (int p = 0; p < states; p++)
+                if (image[p] < far)
+                    reached.push_back(p);
+            for (int q : reached) {
+                for (int p : reached) {
+                    if (p != q && image[p] <= image[q]
+                        && covered[size_t(q) * states + p]) {
+                        image[q] = far;
+                        break;
+                    }
+                }
+            }
+            next.push_back(add(image));
+        }
+    }
+
+    explored = int(found.size());
+    return TransitionTable(explored, width, 0, next, accepting).minimized();
+}
+
+template class HammingNeighborhood<char>;
+template class HammingNeighborhood<unsigned char>;
+template class HammingNeighborhood<char32_t>;
@@ -0,0 +1,68 @@
+/** ***************************************************************************
+ * @file:   HammingNeighborhood.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class template called
+ *  HammingNeighborhood
+ * @remark: A HammingNeighborhood is the language N_d(L) of the strings
+ *  within Hamming distance d of some string in L of the same length,
+ *  i.e. those that can be put into L by changing at most d symbols. It
+ *  is recognized by a DFA whose states map every state q of the
+ *  minimized δ to the least number of changes e(q) <= d with which the
+ *  input read so far leads to q. Reading σ gives the map
+ *      e'(p) = min over q, τ with δ(q, τ) = p of e(q) + [τ ≠ σ]
+ *  and the map accepts if e(q) <= d for some q ∈ F. An entry q adds
+ *  nothing when the map holds some p with e(p) <= e(q) from which every
+ *  string accepted from q is accepted too, so such entries are dropped,
+ *  and so are states from which F cannot be reached.
+ *
+ *  Only the maps reachable from the start map {q₀ ↦ 0} are built, in
+ *  breadth-first order, and the result is minimized, so its size depends
+ *  on how many maps actually occur rather than on (d + 2)^|Q|; for L
+ *  that is 7713 maps for d = 1 and about 10^5 for d = 2. A limit
+ *  on the number of maps stops the construction with a length_error
+ *  before it runs out of memory. The minimized table plugs into a
+ *  CountTable like δ itself does.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_HAMMINGNEIGHBORHOOD_HPP
+#define INC_454_P1_HAMMINGNEIGHBORHOOD_HPP
+
+
+#include "DFA.hpp"
+#include "TransitionTable.hpp"
+#include "CountTable.hpp"
+#include <string>
+
+template<typename T>
+class HammingNeighborhood {
+public:
+    static constexpr int MAX_DISTANCE = 254;
+    static constexpr int MAX_STATES = 1 << 18;
+    typedef typename DFA<T>::String String;
+
+    HammingNeighborhood(const DFA<T> &dfa, int distance,
+                        int maxStates = MAX_STATES);
+    int distance() const;
+    int explored() const;
+    const TransitionTable &automaton() const;
+    bool within(const String &input) const;
+    BigUnsigned count(int n);
+
+private:
+    static TransitionTable build(const TransitionTable &delta, int distance,
+                                 int maxStates, int &explored);
+
+    const DFA<T> &dfa;
+    int radius;
+
+    // number of maps built before minimizing
+    int maps;
+
+    // the counts over the minimized DFA of N_d(L), which holds the DFA
+    CountTable<BigUnsigned> counts;
+};
+
+
+#endif //INC_454_P1_HAMMINGNEIGHBORHOOD_HPP
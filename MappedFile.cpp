@@ -0,0 +1,106 @@
+/** ***************************************************************************
+ * @file:   MappedFile.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  MappedFile, on top of the POSIX open/fstat/mmap/madvise calls. An empty
+ *  file is not mapped at all, since a mapping cannot have length 0.
+ *
+ *****************************************************************************/
+
+#include "MappedFile.hpp"
+#include <stdexcept>
+#include <cerrno>
+#include <cstring>   // for std::strerror
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+/** ***************************************************************************
+ * MappedFile constructor - map a file read-only
+ * @param  path: the file to map
+ * @post   the file's contents are available through data() and size();
+ *         throws std::runtime_error if the file cannot be opened or mapped
+ *         or is not a regular file
+ *
+ *****************************************************************************/
+MappedFile::MappedFile(const std::string &path) : address(nullptr), length(0) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error(path + ": " + std::strerror(errno));
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        int error = errno;
+        close(fd);
+        throw std::runtime_error(path + ": " + std::strerror(error));
+    }
+
+    // the size of anything else is not the amount of data it holds
+    if (!S_ISREG(info.st_mode)) {
+        close(fd);
+        throw std::runtime_error(path + ": not a regular file");
+    }
+
+    length = size_t(info.st_size);
+    if (length > 0) {
+        address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            int error = errno;
+            close(fd);
+            address = nullptr;
+            throw std::runtime_error(path + ": " + std::strerror(error));
+        }
+        // a failed hint is harmless
+        madvise(address, length, MADV_SEQUENTIAL);
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+}
+
+
+/** ***************************************************************************
+ * MappedFile destructor - unmap the file
+ *
+ *****************************************************************************/
+MappedFile::~MappedFile() {
+    if (address != nullptr)
+        munmap(address, length);
+}
+
+
+/** ***************************************************************************
+ * @return the first byte of the file, nullptr for an empty file
+ *
+ *****************************************************************************/
+const unsigned char *MappedFile::data() const {
+    return static_cast<const unsigned char *>(address);
+}
+
+
+/** ***************************************************************************
+ * @return the size of the file in bytes
+ *
+ *****************************************************************************/
+size_t MappedFile::size() const {
+    return length;
+}
+
+
+/** ***************************************************************************
+ * tell whether a file is worth mapping
+ * @param  path: the file
+ * @post   return true for a regular file that reports a size above 0;
+ *         false for other files, for files like those under /proc that
+ *         report 0 but may hold data, and for paths that cannot be
+ *         examined, whose errors are then left to the reader
+ *
+ *****************************************************************************/
+bool MappedFile::mappable(const std::string &path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode)
+           && info.st_size > 0;
+}
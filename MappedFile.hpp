@@ -0,0 +1,43 @@
+/** ***************************************************************************
+ * @file:   MappedFile.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called MappedFile
+ * @remark: A MappedFile maps a whole file read-only into memory and tells
+ *  the kernel it will be read front to back, so that a scan can walk the
+ *  file's bytes in place, without copying them into stream buffers or
+ *  strings. The mapping is removed when the object is destroyed.
+ *
+ *  Only regular files can be mapped. Pipes, devices and the like are
+ *  rejected, and files under /proc or /sys report a size of 0 whatever
+ *  they hold, so mappable() tells a scanner when to read a file as a
+ *  stream instead.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_MAPPEDFILE_HPP
+#define INC_454_P1_MAPPEDFILE_HPP
+
+
+#include <cstddef>
+#include <string>
+
+class MappedFile {
+public:
+    explicit MappedFile(const std::string &path);
+    ~MappedFile();
+    MappedFile(const MappedFile &other) = delete;
+    MappedFile &operator = (const MappedFile &other) = delete;
+
+    const unsigned char *data() const;
+    size_t size() const;
+
+    static bool mappable(const std::string &path);
+
+private:
+    void *address;
+    size_t length;
+};
+
+
+#endif //INC_454_P1_MAPPEDFILE_HPP
@@ -0,0 +1,224 @@
+/** ***************************************************************************
+ * @file:   ParallelMatcher.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  ParallelMatcher. The first chunk only needs the run from q₀ and is
+ *  matched directly; every other chunk is mapped for all states of M.
+ *  There is one chunk per thread, so the mappings are composed in order
+ *  on the calling thread once all workers are done.
+ *
+ *****************************************************************************/
+
+#include "ParallelMatcher.hpp"
+#include "MappedFile.hpp"
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+
+/** ***************************************************************************
+ * ParallelMatcher constructor
+ * @param  dfa: the DFA M to run, must outlive the matcher
+ * @param  threads: number of threads, 0 for one per hardware thread
+ * @param  minChunk: inputs are not split into chunks smaller than this
+ *
+ *****************************************************************************/
+template<typename T>
+ParallelMatcher<T>::ParallelMatcher(const DFA<T> &dfa, unsigned threads,
+                                    size_t minChunk)
+    : dfa(dfa), threads(threads), minChunk(minChunk ? minChunk : 1) {
+    if (this->threads == 0)
+        this->threads = std::thread::hardware_concurrency();
+    if (this->threads == 0)
+        this->threads = 1;
+}
+
+
+/** ***************************************************************************
+ * run every state of M through a chunk of the input
+ * @param  data: the chunk
+ * @param  length: number of symbols in the chunk
+ * @param  map: receives the final state and death offset of each state
+ *
+ *****************************************************************************/
+template<typename T>
+void ParallelMatcher<T>::map_chunk(const T *data, size_t length,
+                                   StateMap &map) const {
+    const int states = DFA<T>::STATES;
+    const int *table = dfa.transition_table();
+    const int width = dfa.table_width();
+
+    // every start state begins as its own run; runs that meet are merged
+    // by pointing the later one at the one already in that state
+    std::vector<int> current(states), merged(states, -1), live;
+    std::vector<uint64_t> died(states, NONE);
+    for (int q = 0; q < states; q++) {
+        current[q] = q;
+        if (q != DFA<T>::DEAD)
+            live.push_back(q);
+    }
+    died[DFA<T>::DEAD] = 0;
+
+    // occupant[q] is the run in state q after the symbol at stamp[q] - 1
+    std::vector<int> occupant(states);
+    std::vector<uint64_t> stamp(states, 0);
+    std::vector<int> next;
+
+    size_t k = 0;
+    for (; k < length && live.size() > 1; k++) {
+        const int symbol = dfa.symbol_class(data[k]);
+        next.clear();
+        for (int run : live) {
+            int q = table[current[run] * width + symbol];
+            if (q == DFA<T>::DEAD) {
+                died[run] = k;
+            }
+            else if (stamp[q] == k + 1) {
+                merged[run] = occupant[q];
+            }
+            else {
+                stamp[q] = k + 1;
+                occupant[q] = run;
+                current[run] = q;
+                next.push_back(run);
+            }
+        }
+        live.swap(next);
+    }
+
+    // one run left: finish the chunk with the single-state matcher
+    if (live.size() == 1 && k < length) {
+        StreamMatcher<T> matcher(dfa);
+        int run = live[0];
+        matcher.reset(current[run]);
+        if (!matcher.feed(data + k, length - k)) {
+            died[run] = k + matcher.result().offset;
+            live.clear();
+        }
+        else {
+            current[run] = matcher.result().state;
+        }
+    }
+
+    map.final.assign(states, DFA<T>::DEAD);
+    map.death.assign(states, 0);
+    for (int q = 0; q < states; q++) {
+        int run = q;
+        while (merged[run] != -1)
+            run = merged[run];
+        // shorten the chain for the other runs merged along it
+        for (int r = q; merged[r] != -1; ) {
+            int up = merged[r];
+            merged[r] = run;
+            r = up;
+        }
+        map.death[q] = died[run];
+        if (died[run] == NONE)
+            map.final[q] = current[run];
+    }
+}
+
+
+/** ***************************************************************************
+ * run a whole buffer through M using several threads
+ * @param  data: the symbols
+ * @param  length: number of symbols
+ * @post   return the same outcome as StreamMatcher::match; the chunks of
+ *         threads that cannot be started are mapped on the calling thread
+ *
+ *****************************************************************************/
+template<typename T>
+MatchResult ParallelMatcher<T>::match(const T *data, size_t length) {
+    size_t chunks = length / minChunk;
+    if (chunks > threads)
+        chunks = threads;
+    if (chunks <= 1) {
+        StreamMatcher<T> matcher(dfa);
+        return matcher.match(data, length);
+    }
+
+    size_t chunkLength = length / chunks;
+    std::vector<StateMap> maps(chunks);
+    std::vector<std::thread> workers;
+    workers.reserve(chunks - 1);
+
+    // chunks from mapped on are mapped on this thread, all of them if no
+    // thread can be started
+    size_t mapped = 1;
+    try {
+        for (; mapped < chunks; mapped++) {
+            size_t begin = mapped * chunkLength;
+            size_t end = mapped + 1 == chunks ? length : begin + chunkLength;
+            workers.emplace_back([this, data, begin, end, c = mapped, &maps] {
+                map_chunk(data + begin, end - begin, maps[c]);
+            });
+        }
+    }
+    catch (const std::exception &) {
+        // no thread could be started (std::system_error) or its state
+        // not allocated (std::bad_alloc); the rest is done below
+    }
+
+    // the first chunk starts in q₀ and is matched on this thread; the
+    // workers must be joined however this ends
+    MatchResult first{};
+    try {
+        for (size_t c = mapped; c < chunks; c++) {
+            size_t begin = c * chunkLength;
+            size_t end = c + 1 == chunks ? length : begin + chunkLength;
+            map_chunk(data + begin, end - begin, maps[c]);
+        }
+        StreamMatcher<T> matcher(dfa);
+        matcher.feed(data, chunkLength);
+        first = matcher.result();
+    }
+    catch (...) {
+        for (std::thread &worker : workers)
+            worker.join();
+        throw;
+    }
+
+    for (std::thread &worker : workers)
+        worker.join();
+
+    if (!first.accepted)
+        return first;
+
+    // compose the chunk mappings in input order
+    int q = first.state;
+    for (size_t c = 1; c < chunks; c++) {
+        const StateMap &map = maps[c];
+        if (map.death[q] != NONE)
+            return MatchResult{false, c * chunkLength + map.death[q],
+                               DFA<T>::DEAD};
+        q = map.final[q];
+    }
+    return MatchResult{true, uint64_t(length), q};
+}
+
+
+/** ***************************************************************************
+ * run a memory-mapped file through M using several threads
+ * @param  path: the file to scan; files that cannot be mapped, such as
+ *         pipes, devices and files under /proc, are read as a stream on
+ *         the calling thread
+ * @post   return the outcome; throws std::runtime_error if the file
+ *         cannot be read or its size is not a multiple of sizeof(T)
+ *
+ *****************************************************************************/
+template<typename T>
+MatchResult ParallelMatcher<T>::match_file(const std::string &path) {
+    if (!MappedFile::mappable(path))
+        return StreamMatcher<T>(dfa).match_file(path);
+
+    MappedFile file(path);
+    if (file.size() % sizeof(T) != 0)
+        throw std::runtime_error("ParallelMatcher: " + path + " ends inside a symbol");
+    return match(reinterpret_cast<const T *>(file.data()),
+                 file.size() / sizeof(T));
+}
+
+template class ParallelMatcher<char>;
+template class ParallelMatcher<unsigned char>;
+template class ParallelMatcher<char32_t>;
@@ -0,0 +1,56 @@
+/** ***************************************************************************
+ * @file:   ParallelMatcher.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called ParallelMatcher
+ * @remark: A ParallelMatcher decides whether a DFA M accepts a large input
+ *  using several threads. The input is split into one chunk per thread.
+ *  Since a worker does not know the state its chunk starts in, it runs
+ *  every state of M through the chunk at once and records, per start
+ *  state, the state reached at the end and the offset at which M died, if
+ *  it did. Runs that reach the same state are merged, and because M is
+ *  small and has a dead sink, all runs collapse into one (or none) within
+ *  a few symbols; the rest of the chunk is then matched like a single run.
+ *  Composing the chunk mappings in order gives the exact final state and
+ *  the first violation offset, as from a StreamMatcher.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_PARALLELMATCHER_HPP
+#define INC_454_P1_PARALLELMATCHER_HPP
+
+
+#include "StreamMatcher.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+template<typename T>
+class ParallelMatcher {
+public:
+    explicit ParallelMatcher(const DFA<T> &dfa, unsigned threads = 0,
+                             size_t minChunk = 1 << 20);
+    MatchResult match(const T *data, size_t length);
+    MatchResult match_file(const std::string &path);
+
+private:
+    // the effect of one chunk on every start state
+    struct StateMap {
+        // state reached at the end of the chunk from each start state
+        std::vector<int> final;
+        // offset within the chunk at which each start state died, or
+        // NONE if it did not
+        std::vector<uint64_t> death;
+    };
+
+    static constexpr uint64_t NONE = UINT64_MAX;
+
+    void map_chunk(const T *data, size_t length, StateMap &map) const;
+
+    const DFA<T> &dfa;
+    unsigned threads;
+    size_t minChunk;
+};
+
+
+#endif //INC_454_P1_PARALLELMATCHER_HPP
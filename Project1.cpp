@@ -14,11 +14,15 @@
 
 
 #include "DFA.hpp"
+#include "ParallelMatcher.hpp"
 #include <iostream>
 #include <fstream>
+#include <stdexcept>
+#include <string>
 
 
 void writeTestcases();
+int scanFiles(int count, char *paths[]);
 
 /** ***************************************************************************
  * write test cases to the file 'testcases.txt'
@@ -31,19 +35,67 @@ void writeTestcases() {
     testcases << "n:\tnumber of strings of length n accepted" << std::endl;
     for (int i = 1; i <= 300; ++i) {
         DFA<char> dfa;
-        testcases << i << ":\t" << dfa.num_strings_accepted(i) << std::endl;
+        testcases << i << ":\t"
+                  << dfa.num_strings_accepted_as<DFA<char>::FixedCount>(i)
+                  << std::endl;
     }
     testcases.close();
 }
 
+/** ***************************************************************************
+ * check whether the contents of files are in L
+ * each file is memory mapped and run through the DFA M in place, split
+ * across all hardware threads when it is large enough; one line
+ * per file reports acceptance or the offset of the first symbol at which
+ * the file stops being in L
+ * @return 0 if every file is in L, 1 if some file is not, 2 on I/O errors
+ *****************************************************************************/
+int scanFiles(int count, char *paths[]) {
+    DFA<char> dfa;
+    ParallelMatcher<char> matcher(dfa);
+    int status = 0;
+
+    for (int i = 0; i < count; ++i) {
+        try {
+            MatchResult result = matcher.match_file(paths[i]);
+            if (result.accepted) {
+                std::cout << paths[i] << ": accepted, "
+                          << result.offset << " symbols" << std::endl;
+            }
+            else {
+                std::cout << paths[i] << ": rejected at offset "
+                          << result.offset << std::endl;
+                if (status == 0)
+                    status = 1;
+            }
+        }
+        catch (const std::runtime_error &error) {
+            std::cerr << "Error: " << error.what() << std::endl;
+            status = 2;
+        }
+    }
+
+    return status;
+}
+
 /** ***************************************************************************
  * main procedure controls input, DFA, and printing
- * When run, the program asks the user to enter an integer n,
+ * When run as 'Project1 --scan FILE...', the program checks whether the
+ * contents of each file are in L and exits.
+ * Otherwise, the program asks the user to enter an integer n,
  * If the user enters -1, the program stops.
  * Else it solves the problem for the user input.
  * This dialog is in a loop and repeats testing until the user enters -1.
  *****************************************************************************/
-int main() {
+int main(int argc, char *argv[]) {
+    if (argc > 1) {
+        if (std::string(argv[1]) == "--scan" && argc > 2)
+            return scanFiles(argc - 2, argv + 2);
+
+        std::cerr << "Usage: " << argv[0] << " [--scan FILE...]" << std::endl;
+        return 2;
+    }
+
     std::cout << "Program to compute the number of strings w "
                  "of length n over {a, b, c, d} with the following property:\n"
                  "In any substring of length 6 of w, "
@@ -64,8 +116,10 @@ int main() {
 
         DFA<char> dfa; // construct DFA M
 
-        // print the number of strings of length n accepted by the DFA M
-        std::cout << dfa.num_strings_accepted(n) << std::endl;
+        // print the number of strings of length n accepted by the DFA M,
+        // n <= 300 so the count fits in a FixedCount
+        std::cout << dfa.num_strings_accepted_as<DFA<char>::FixedCount>(n)
+                  << std::endl;
 
     }
 
@@ -0,0 +1,106 @@
+/** ***************************************************************************
+ * @file:   Ranker.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called Ranker
+ *
+ *****************************************************************************/
+
+#include "Ranker.hpp"
+#include <stdexcept>
+
+
+/** ***************************************************************************
+ * Ranker constructor
+ * @param  dfa: the DFA M, must outlive the ranker
+ *
+ *****************************************************************************/
+template<typename T>
+Ranker<T>::Ranker(const DFA<T> &dfa)
+    : dfa(dfa), counts(TransitionTable(dfa).minimized(), dfa.table_width() - 1) {
+    for (int s = 0; s < counts.letters(); s++)
+        letters.push_back(dfa.letter(s));
+}
+
+
+/** ***************************************************************************
+ * @param  n: the length, n >= 0
+ * @return the number of strings of length n accepted by M
+ *
+ *****************************************************************************/
+template<typename T>
+BigUnsigned Ranker<T>::count(int n) {
+    if (n < 0)
+        throw std::invalid_argument("Ranker::count: negative length");
+    counts.extend(n);
+    return counts.row(n)[counts.transitions().start()];
+}
+
+
+/** ***************************************************************************
+ * find the accepted string with a given number
+ * @param  n: the length
+ * @param  k: the number, k < count(n)
+ * @post   return the k-th accepted string of length n, counting from 0
+ *
+ *****************************************************************************/
+template<typename T>
+typename Ranker<T>::String Ranker<T>::unrank(int n, const BigUnsigned &k) {
+    if (!(k < count(n)))
+        throw std::out_of_range("Ranker::unrank: k is not below count(n)");
+
+    const TransitionTable &delta = counts.transitions();
+    const int symbols = counts.letters();
+    String w;
+    w.reserve(n);
+
+    // r numbers the rest of w among the strings of length i accepted from q
+    BigUnsigned r = k;
+    int q = delta.start();
+    for (int i = n; i > 0; i--) {
+        const BigUnsigned *next = counts.row(i - 1);
+        int s = 0;
+        while (s < symbols - 1 && next[delta.next(q, s)] <= r) {
+            r -= next[delta.next(q, s)];
+            s++;
+        }
+        q = delta.next(q, s);
+        w.push_back(letters[s]);
+    }
+    return w;
+}
+
+
+/** ***************************************************************************
+ * find the number of an accepted string
+ * @param  w: a string accepted by M
+ * @post   return the number of accepted strings of the same length that
+ *         come before w
+ *
+ *****************************************************************************/
+template<typename T>
+BigUnsigned Ranker<T>::rank(const String &w) {
+    const int n = int(w.size());
+    counts.extend(n);
+    const TransitionTable &delta = counts.transitions();
+    const int symbols = counts.letters();
+
+    BigUnsigned r;
+    int q = delta.start();
+    for (int i = n; i > 0; i--) {
+        int c = dfa.symbol_class(w[n - i]);
+        if (c >= symbols)
+            throw std::invalid_argument("Ranker::rank: symbol outside Σ");
+        const BigUnsigned *next = counts.row(i - 1);
+        for (int s = 0; s < c; s++)
+            r += next[delta.next(q, s)];
+        q = delta.next(q, c);
+    }
+    if (!delta.accepting(q))
+        throw std::invalid_argument("Ranker::rank: string not accepted");
+    return r;
+}
+
+template class Ranker<char>;
+template class Ranker<unsigned char>;
+template class Ranker<char32_t>;
@@ -0,0 +1,47 @@
+/** ***************************************************************************
+ * @file:   Ranker.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called Ranker
+ * @remark: A Ranker numbers the strings of length n accepted by M in
+ *  lexicographic order, the order of Σ, from 0 to count(n) - 1, and maps
+ *  between strings and their numbers without listing the strings before
+ *  them. The strings that start with a letter smaller than σ from state q
+ *  with k symbols left number Σ count(δ(q, σ'), k - 1) over σ' < σ, so
+ *  unrank(n, k) picks each letter by subtracting these counts from k, and
+ *  rank(w) adds them up along w. Both take O(n |Σ|) BigUnsigned operations
+ *  on counts that are computed once per length and kept for later calls.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_RANKER_HPP
+#define INC_454_P1_RANKER_HPP
+
+
+#include "DFA.hpp"
+#include "CountTable.hpp"
+#include <string>
+#include <vector>
+
+template<typename T>
+class Ranker {
+public:
+    typedef typename DFA<T>::String String;
+
+    explicit Ranker(const DFA<T> &dfa);
+    BigUnsigned count(int n);
+    String unrank(int n, const BigUnsigned &k);
+    BigUnsigned rank(const String &w);
+
+private:
+    const DFA<T> &dfa;
+
+    // the letter of each symbol class
+    std::vector<T> letters;
+
+    // counts over the minimized δ, extended to the longest length asked for
+    CountTable<BigUnsigned> counts;
+};
+
+
+#endif //INC_454_P1_RANKER_HPP
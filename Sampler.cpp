@@ -0,0 +1,224 @@
+/** ***************************************************************************
+ * @file:   Sampler.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of the classes Sampler and
+ *  Xoshiro256. Xoshiro256 is xoshiro256** by Blackman and Vigna, seeded
+ *  through splitmix64.
+ *
+ *****************************************************************************/
+
+#include "Sampler.hpp"
+#include <stdexcept>
+
+
+/** ***************************************************************************
+ * Xoshiro256 constructor
+ * @param  seed: any value, equal seeds give equal sequences
+ *
+ *****************************************************************************/
+Xoshiro256::Xoshiro256(uint64_t seed) {
+    for (uint64_t &word : s) {
+        seed += 0x9E3779B97F4A7C15u;
+        uint64_t z = seed;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+        word = z ^ (z >> 31);
+    }
+}
+
+
+/** ***************************************************************************
+ * @return the next 64 random bits
+ *
+ *****************************************************************************/
+uint64_t Xoshiro256::operator () () {
+    auto rotate = [](uint64_t x, int k) { return (x << k) | (x >> (64 - k)); };
+    uint64_t result = rotate(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotate(s[3], 45);
+    return result;
+}
+
+
+/** ***************************************************************************
+ * @return a random double in [0, 1) with 53 random bits
+ *
+ *****************************************************************************/
+double Xoshiro256::uniform() {
+    return double((*this)() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+
+/** ***************************************************************************
+ * Sampler constructor - build the counts for strings of length n
+ * @param  dfa: the DFA M
+ * @param  n: the length of the strings to draw, n >= 0
+ * @param  mode: EXACT or APPROXIMATE, see the header
+ * @param  seed: seed of the random number generator
+ * @pre    M accepts at least one string of length n
+ *
+ *****************************************************************************/
+template<typename T>
+Sampler<T>::Sampler(const DFA<T> &dfa, int n, Mode mode, uint64_t seed)
+    : n(n), mode(mode), random(seed) {
+    if (n < 0)
+        throw std::invalid_argument("Sampler: negative length");
+
+    const int symbols = dfa.table_width() - 1;
+    for (int s = 0; s < symbols; s++)
+        letters.push_back(dfa.letter(s));
+    weights.resize(symbols);
+
+    TransitionTable delta = TransitionTable(dfa).minimized();
+    bool empty;
+    if (mode == Mode::EXACT && n <= DFA<T>::FIXED_MAX_N) {
+        typedef typename DFA<T>::FixedCount Count;
+        exact.reset(new CountTable<Count>(delta, symbols));
+        exact->extend(n);
+        empty = exact->row(n)[delta.start()] == Count(0);
+    }
+    else if (mode == Mode::EXACT) {
+        big.reset(new CountTable<BigUnsigned>(delta, symbols));
+        big->extend(n);
+        empty = big->row(n)[delta.start()] == BigUnsigned(0);
+    }
+    else {
+        approximate.reset(new CountTable<double>(delta, symbols));
+        approximate->extend(n);
+        empty = approximate->row(n)[delta.start()] == 0;
+    }
+    if (empty)
+        throw std::invalid_argument("Sampler: no string of length n is accepted");
+}
+
+
+/** ***************************************************************************
+ * @return the length of the strings drawn
+ *
+ *****************************************************************************/
+template<typename T>
+int Sampler<T>::length() const {
+    return n;
+}
+
+
+/** ***************************************************************************
+ * draw strings
+ * @remark: strings are drawn GROUP at a time, one symbol of every string
+ *  of the group per step, so that each row of counts is brought into the
+ *  cache once per group instead of once per string
+ *
+ * @param  out: room for count * length() symbols
+ * @param  count: number of strings
+ * @post   string i is out[i * length() .. (i + 1) * length())
+ *
+ *****************************************************************************/
+template<typename T>
+void Sampler<T>::sample(T *out, size_t count) {
+    for (size_t i = 0; i < count; i += GROUP) {
+        size_t strings = count - i < GROUP ? count - i : GROUP;
+        if (exact)
+            sample_exact(*exact, out + i * n, strings);
+        else if (big)
+            sample_exact(*big, out + i * n, strings);
+        else
+            sample_approximate(out + i * n, strings);
+    }
+}
+
+
+/** ***************************************************************************
+ * draw a group of strings through their indices among the accepted strings
+ * @param  counts: the counts, FixedCount or BigUnsigned
+ * @param  out: room for strings * length() symbols
+ * @param  strings: number of strings, at most GROUP
+ *
+ *****************************************************************************/
+template<typename T>
+template<typename Count>
+void Sampler<T>::sample_exact(const CountTable<Count> &counts, T *out,
+                              size_t strings) {
+    const TransitionTable &delta = counts.transitions();
+    const int *table = delta.data();
+    const int width = delta.width();
+    const int symbols = counts.letters();
+
+    // r[g] < count(q[g], k) is the index of the rest of string g among the
+    // strings of length k accepted from q[g], in the order of Σ
+    int q[GROUP];
+    Count r[GROUP];
+    for (size_t g = 0; g < strings; g++) {
+        q[g] = delta.start();
+        r[g] = Count::uniform_below(counts.row(n)[q[g]], random);
+    }
+
+    for (int k = n; k > 0; k--) {
+        const Count *next = counts.row(k - 1);
+        for (size_t g = 0; g < strings; g++) {
+            const int *targets = table + q[g] * width;
+            int s = 0;
+            while (s < symbols - 1 && !(r[g] < next[targets[s]])) {
+                r[g] -= next[targets[s]];
+                s++;
+            }
+            q[g] = targets[s];
+            out[g * n + (n - k)] = letters[s];
+        }
+    }
+}
+
+
+/** ***************************************************************************
+ * draw a group of strings with floating-point weights
+ * @param  out: room for strings * length() symbols
+ * @param  strings: number of strings, at most GROUP
+ *
+ *****************************************************************************/
+template<typename T>
+void Sampler<T>::sample_approximate(T *out, size_t strings) {
+    const TransitionTable &delta = approximate->transitions();
+    const int *table = delta.data();
+    const int width = delta.width();
+    const int symbols = approximate->letters();
+    double *weight = weights.data();
+
+    int q[GROUP];
+    for (size_t g = 0; g < strings; g++)
+        q[g] = delta.start();
+
+    for (int k = n; k > 0; k--) {
+        // the rows are scaled, but only the ratios within row k - 1 matter
+        const double *next = approximate->row(k - 1);
+        for (size_t g = 0; g < strings; g++) {
+            const int *targets = table + q[g] * width;
+            double total = 0;
+            for (int s = 0; s < symbols; s++) {
+                weight[s] = next[targets[s]];
+                total += weight[s];
+            }
+
+            double pick = random.uniform() * total;
+            int s = 0;
+            for (; s < symbols - 1; s++) {
+                if (pick < weight[s] && weight[s] > 0)
+                    break;
+                pick -= weight[s];
+            }
+            // rounding may run past the last letter with a weight
+            while (weight[s] == 0)
+                s--;
+            q[g] = targets[s];
+            out[g * n + (n - k)] = letters[s];
+        }
+    }
+}
+
+template class Sampler<char>;
+template class Sampler<unsigned char>;
+template class Sampler<char32_t>;
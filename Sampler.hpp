@@ -0,0 +1,75 @@
+/** ***************************************************************************
+ * @file:   Sampler.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called Sampler and
+ *  of the random number generator it uses, Xoshiro256
+ * @remark: A Sampler draws strings of length n uniformly at random from the
+ *  strings accepted by M. The DP that counts them is kept per length in a
+ *  CountTable over the minimized δ: from state q with k symbols left, the
+ *  letter σ is picked with probability count(δ(q, σ), k - 1) / count(q, k),
+ *  so every accepted string is equally likely. After the table is built
+ *  once, in O(n |Q|) steps, each string costs O(n |Σ|) steps.
+ *
+ *  EXACT mode draws one random number below count(q₀, n) and walks δ by
+ *  subtracting the counts of the letters passed over. The counts are
+ *  FixedCount for n <= DFA::FIXED_MAX_N and BigUnsigned above, which is
+ *  slower but just as exact. APPROXIMATE mode compares one random double
+ *  with floating-point counts per symbol and is faster, but the
+ *  probabilities are only as exact as a double.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_SAMPLER_HPP
+#define INC_454_P1_SAMPLER_HPP
+
+
+#include "DFA.hpp"
+#include "CountTable.hpp"
+#include <cstdint>
+#include <memory>
+
+class Xoshiro256 {
+public:
+    explicit Xoshiro256(uint64_t seed);
+    uint64_t operator () ();
+    double uniform();
+
+private:
+    uint64_t s[4];
+};
+
+template<typename T>
+class Sampler {
+public:
+    enum class Mode { EXACT, APPROXIMATE };
+
+    Sampler(const DFA<T> &dfa, int n, Mode mode = Mode::EXACT,
+            uint64_t seed = 0x9E3779B97F4A7C15u);
+    int length() const;
+    void sample(T *out, size_t count);
+
+private:
+    // strings drawn side by side
+    static constexpr size_t GROUP = 64;
+
+    template<typename Count>
+    void sample_exact(const CountTable<Count> &counts, T *out, size_t strings);
+    void sample_approximate(T *out, size_t strings);
+
+    int n;
+    Mode mode;
+    Xoshiro256 random;
+
+    // the letter of each symbol class, and room for their weights
+    std::vector<T> letters;
+    std::vector<double> weights;
+
+    // one of the three is built, depending on the mode and on n
+    std::unique_ptr<CountTable<typename DFA<T>::FixedCount>> exact;
+    std::unique_ptr<CountTable<BigUnsigned>> big;
+    std::unique_ptr<CountTable<double>> approximate;
+};
+
+
+#endif //INC_454_P1_SAMPLER_HPP
@@ -0,0 +1,301 @@
+/** ***************************************************************************
+ * @file:   StreamMatcher.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  StreamMatcher. The matcher keeps a copy of δ whose entries are row
+ *  offsets rather than state numbers, which takes the multiplication off
+ *  the chain of dependent loads. The inner loop runs blocks of symbols without testing
+ *  for the dead state; since the dead state is a sink, one test at the end
+ *  of a block is enough, and only a rejected block is run again to find
+ *  the exact offset of the violation.
+ *
+ *****************************************************************************/
+
+#include "StreamMatcher.hpp"
+#include "MappedFile.hpp"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <fcntl.h>  // for open
+#include <unistd.h> // for read
+
+// symbols run between two tests for the dead state
+static const size_t BLOCK = 64;
+
+
+/** ***************************************************************************
+ * StreamMatcher constructor - start matching from q₀
+ * @param  dfa: the DFA M to run, must outlive the matcher
+ * @param  chunkSize: number of symbols read at a time from streams and
+ *         file descriptors
+ * @param  windowKernel: false to run all input through δ
+ *
+ *****************************************************************************/
+template<typename T>
+StreamMatcher<T>::StreamMatcher(const DFA<T> &dfa, size_t chunkSize,
+                                bool windowKernel)
+    : dfa(dfa), chunkSize(chunkSize ? chunkSize : 1),
+      scanner(dfa.symbol_classes(), dfa.table_width() - 1, DFA<T>::WINDOW) {
+    useScanner = windowKernel && sizeof(T) == 1
+                 && dfa.unknown_symbols() == DFA<T>::UnknownSymbol::REJECT
+                 && WindowScanner::supported(dfa.table_width() - 1);
+
+    // store the offset of every target row instead of the target state,
+    // so that a step is one addition and one load
+    const int width = dfa.table_width();
+    rows.assign(dfa.transition_table(),
+                dfa.transition_table() + DFA<T>::STATES * width);
+    for (int &target : rows)
+        target *= width;
+    reset();
+}
+
+
+/** ***************************************************************************
+ * forget all input and start again from q₀, or from another state
+ * @param  start: the state to start from
+ *
+ *****************************************************************************/
+template<typename T>
+void StreamMatcher<T>::reset(int start) {
+    state = start;
+    consumed = 0;
+}
+
+
+/** ***************************************************************************
+ * run the next piece of the input through M
+ * @param  data: the symbols
+ * @param  length: number of symbols
+ * @post   return false once the input read so far is rejected, in which
+ *         case later calls do nothing
+ *
+ *****************************************************************************/
+template<typename T>
+bool StreamMatcher<T>::feed(const T *data, size_t length) {
+    if (state == DFA<T>::DEAD)
+        return false;
+    if (!useScanner)
+        return step(data, length);
+
+    // the windows that reach back into earlier input are decided by δ,
+    // which remembers that input in its state
+    const size_t history = DFA<T>::WINDOW - 1;
+    size_t head = length < history ? length : history;
+    if (!step(data, head))
+        return false;
+    if (head == length)
+        return true;
+
+    // every later window lies inside this piece
+    uint64_t start = consumed - head;
+    size_t p = scanner.first_violation(
+        reinterpret_cast<const unsigned char *>(data), length);
+    if (p < length) {
+        state = DFA<T>::DEAD;
+        consumed = start + p;
+        return false;
+    }
+
+    // once WINDOW - 1 symbols have been read, the state of M is the one
+    // reached from q₀ on the last WINDOW - 1 symbols
+    const int *table = dfa.transition_table();
+    int q = DFA<T>::START;
+    for (size_t k = length - history; k < length; k++)
+        q = table[q * dfa.table_width() + dfa.symbol_class(data[k])];
+    state = q;
+    consumed = start + length;
+    return true;
+}
+
+
+/** ***************************************************************************
+ * run symbols through δ
+ * @param  data: the symbols
+ * @param  length: number of symbols
+ * @post   return false if M reached its dead state, with consumed set to
+ *         the offset of the symbol that took it there
+ *
+ *****************************************************************************/
+template<typename T>
+bool StreamMatcher<T>::step(const T *data, size_t length) {
+
+    const int *table = rows.data();
+    const int dead = DFA<T>::DEAD * dfa.table_width();
+
+    // q is the offset of the current state's row
+    int q = state * dfa.table_width();
+    size_t i = 0;
+    while (i < length) {
+        size_t end = i + BLOCK < length ? i + BLOCK : length;
+        int blockStart = q;
+        for (size_t k = i; k < end; k++)
+            q = table[q + dfa.symbol_class(data[k])];
+
+        if (q == dead) {
+            // run the block again to find the symbol that killed M
+            q = blockStart;
+            size_t k = i;
+            for (; q != dead; k++)
+                q = table[q + dfa.symbol_class(data[k])];
+            state = DFA<T>::DEAD;
+            consumed += k - 1;
+            return false;
+        }
+        i = end;
+    }
+
+    state = q / dfa.table_width();
+    consumed += length;
+    return true;
+}
+
+
+/** ***************************************************************************
+ * @return the outcome for the input read since the last reset
+ *
+ *****************************************************************************/
+template<typename T>
+MatchResult StreamMatcher<T>::result() const {
+    return MatchResult{state != DFA<T>::DEAD, consumed, state};
+}
+
+
+/** ***************************************************************************
+ * run a whole buffer through M
+ * @param  data: the symbols
+ * @param  length: number of symbols
+ * @post   return the outcome; the matcher is reset first
+ *
+ *****************************************************************************/
+template<typename T>
+MatchResult StreamMatcher<T>::match(const T *data, size_t length) {
+    reset();
+    feed(data, length);
+    return result();
+}
+
+
+/** ***************************************************************************
+ * run the whole symbols of the bytes read into the buffer through M
+ * @param  pending: number of bytes of a partial symbol at the front of the
+ *         buffer, left by the previous read; set to the number left now
+ * @param  got: number of bytes just read behind them
+ * @post   return false once the input read so far is rejected; the bytes of
+ *         a trailing partial symbol are moved to the front of the buffer
+ *
+ *****************************************************************************/
+template<typename T>
+bool StreamMatcher<T>::feed_bytes(size_t &pending, size_t got) {
+    unsigned char *bytes = reinterpret_cast<unsigned char *>(buffer.data());
+    const size_t total = pending + got;
+    const size_t symbols = total / sizeof(T);
+    pending = total - symbols * sizeof(T);
+    if (!feed(buffer.data(), symbols))
+        return false;
+    std::memmove(bytes, bytes + symbols * sizeof(T), pending);
+    return true;
+}
+
+
+/** ***************************************************************************
+ * run everything an input stream holds through M
+ * @param  in: the stream, read in chunks until its end or a violation
+ * @post   return the outcome; the matcher is reset first. Throws
+ *         std::runtime_error if reading fails or the stream ends inside a
+ *         symbol
+ *
+ *****************************************************************************/
+template<typename T>
+MatchResult StreamMatcher<T>::match(std::istream &in) {
+    reset();
+    buffer.resize(chunkSize);
+    char *bytes = reinterpret_cast<char *>(buffer.data());
+    const size_t capacity = chunkSize * sizeof(T);
+    size_t pending = 0;
+    while (in) {
+        in.read(bytes + pending, std::streamsize(capacity - pending));
+        size_t got = size_t(in.gcount());
+        if (got > 0 && !feed_bytes(pending, got))
+            return result();
+    }
+    if (in.bad())
+        throw std::runtime_error("StreamMatcher: reading the stream failed");
+    if (pending != 0)
+        throw std::runtime_error("StreamMatcher: input ends inside a symbol");
+    return result();
+}
+
+
+/** ***************************************************************************
+ * run everything that can be read from a file descriptor through M
+ * @param  fd: an open file descriptor, read until end of file or a
+ *         violation
+ * @post   return the outcome; the matcher is reset first. Throws
+ *         std::system_error if a read fails and std::runtime_error if the
+ *         input ends inside a symbol
+ *
+ *****************************************************************************/
+template<typename T>
+MatchResult StreamMatcher<T>::match_fd(int fd) {
+    reset();
+    buffer.resize(chunkSize);
+    char *bytes = reinterpret_cast<char *>(buffer.data());
+    const size_t capacity = chunkSize * sizeof(T);
+    size_t pending = 0;
+    for (;;) {
+        ssize_t got = read(fd, bytes + pending, capacity - pending);
+        if (got < 0) {
+            if (errno == EINTR)
+                continue;
+            throw std::system_error(errno, std::generic_category(),
+                                    "StreamMatcher: read failed");
+        }
+        if (got == 0)
+            break;
+        if (!feed_bytes(pending, size_t(got)))
+            return result();
+    }
+    if (pending != 0)
+        throw std::runtime_error("StreamMatcher: input ends inside a symbol");
+    return result();
+}
+
+/** ***************************************************************************
+ * run a file through M by mapping it into memory and walking the mapping
+ * @param  path: the file to scan; files that cannot be mapped, such as
+ *         pipes, devices and files under /proc, are read with match_fd
+ * @post   return the outcome; the matcher is reset first. Throws
+ *         std::runtime_error if the file cannot be read or its size is
+ *         not a multiple of sizeof(T)
+ *
+ *****************************************************************************/
+template<typename T>
+MatchResult StreamMatcher<T>::match_file(const std::string &path) {
+    if (!MappedFile::mappable(path)) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), path);
+        try {
+            MatchResult outcome = match_fd(fd);
+            close(fd);
+            return outcome;
+        }
+        catch (...) {
+            close(fd);
+            throw;
+        }
+    }
+
+    MappedFile file(path);
+    if (file.size() % sizeof(T) != 0)
+        throw std::runtime_error("StreamMatcher: " + path + " ends inside a symbol");
+    return match(reinterpret_cast<const T *>(file.data()),
+                 file.size() / sizeof(T));
+}
+
+template class StreamMatcher<char>;
+template class StreamMatcher<unsigned char>;
+template class StreamMatcher<char32_t>;
@@ -0,0 +1,81 @@
+/** ***************************************************************************
+ * @file:   StreamMatcher.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called StreamMatcher
+ * @remark: A StreamMatcher runs input of any length through the transition
+ *  function δ of a DFA M and decides whether M accepts it. The input can
+ *  arrive in pieces (feed), as one buffer, from an std::istream or from a
+ *  file descriptor; streams and descriptors are read in large chunks,
+ *  wide symbols split between two reads are joined, and a failed read or
+ *  input that ends inside a symbol throws rather than giving a result.
+ *  Files can also be memory mapped and scanned in place (match_file).
+ *  For byte input the bulk of each piece is checked by a WindowScanner,
+ *  which needs no table lookups at all; passing windowKernel = false runs
+ *  everything through δ, the reference behaviour.
+ *  Every symbol costs one symbol class lookup and one table lookup, and
+ *  matching stops as soon as M reaches its dead state, since the input is
+ *  then rejected whatever follows.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_STREAMMATCHER_HPP
+#define INC_454_P1_STREAMMATCHER_HPP
+
+
+#include "DFA.hpp"
+#include "WindowScanner.hpp"
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+// outcome of running an input through M
+struct MatchResult {
+    // true if M accepts the input
+    bool accepted;
+    // offset of the first symbol that sent M to its dead state, or the
+    // number of symbols read if the input was accepted
+    uint64_t offset;
+    // the state M ended in
+    int state;
+};
+
+template<typename T>
+class StreamMatcher {
+public:
+    explicit StreamMatcher(const DFA<T> &dfa, size_t chunkSize = 1 << 16,
+                           bool windowKernel = true);
+    void reset(int start = DFA<T>::START);
+    bool feed(const T *data, size_t length);
+    MatchResult result() const;
+
+    MatchResult match(const T *data, size_t length);
+    MatchResult match(std::istream &in);
+    MatchResult match_fd(int fd);
+    MatchResult match_file(const std::string &path);
+
+private:
+    bool step(const T *data, size_t length);
+    bool feed_bytes(size_t &pending, size_t got);
+
+    const DFA<T> &dfa;
+    size_t chunkSize;
+
+    // data-parallel check used in place of δ where possible
+    WindowScanner scanner;
+    bool useScanner;
+
+    // δ with every target state q replaced by q * dfa.table_width()
+    std::vector<int> rows;
+
+    // current state and number of symbols consumed so far
+    int state;
+    uint64_t consumed;
+
+    // buffer for reading streams and file descriptors
+    std::vector<T> buffer;
+};
+
+
+#endif //INC_454_P1_STREAMMATCHER_HPP
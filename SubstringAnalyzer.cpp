@@ -0,0 +1,170 @@
+/** ***************************************************************************
+ * @file:   SubstringAnalyzer.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  SubstringAnalyzer. Windows are checked with the same class masks and
+ *  64-bit history word as in ViolationReporter, which needs |Σ| + 1 <= 8
+ *  symbol classes.
+ *
+ *****************************************************************************/
+
+#include "SubstringAnalyzer.hpp"
+#include <string>
+#include <stdexcept>
+
+// symbols per block; a block adds less than BLOCK * position to the count
+static const size_t BLOCK = 1 << 16;
+
+
+/** ***************************************************************************
+ * SubstringAnalyzer constructor
+ * @param  dfa: the DFA M whose alphabet is used, must outlive the analyzer
+ *         and reject symbols outside Σ
+ *
+ *****************************************************************************/
+template<typename T>
+SubstringAnalyzer<T>::SubstringAnalyzer(const DFA<T> &dfa) : dfa(dfa) {
+    if (dfa.unknown_symbols() != DFA<T>::UnknownSymbol::REJECT)
+        throw std::invalid_argument("SubstringAnalyzer: the DFA must reject unknown symbols");
+    for (int byte = 0; byte < 256; byte++)
+        masks[byte] = 1u << dfa.symbol_classes()[byte];
+    reset();
+}
+
+
+/** ***************************************************************************
+ * forget all input
+ *
+ *****************************************************************************/
+template<typename T>
+void SubstringAnalyzer<T>::reset() {
+    position = 0;
+    history = 0;
+    earliest = 0;
+    bestOffset = 0;
+    bestLength = 0;
+    total = BigUnsigned();
+}
+
+
+/** ***************************************************************************
+ * read the next piece of the text
+ * @param  data: the symbols
+ * @param  length: number of symbols
+ *
+ *****************************************************************************/
+template<typename T>
+void SubstringAnalyzer<T>::feed(const T *data, size_t length) {
+    static_assert(DFA<T>::WINDOW <= 8, "the window must fit in the history word");
+    const uint64_t window = DFA<T>::WINDOW;
+    const uint64_t windowBytes = (uint64_t(1) << (8 * window)) - 1;
+    const uint32_t letters = dfa.letter_mask();
+    const uint32_t foreign = letters + 1;
+
+    for (size_t begin = 0; begin < length; begin += BLOCK) {
+        size_t end = length - begin < BLOCK ? length : begin + BLOCK;
+        uint64_t h = history;
+        uint64_t first = earliest;
+        uint64_t sum = 0;
+
+        for (size_t k = begin; k < end; k++) {
+            uint64_t r = position + k - begin;
+            uint32_t own = sizeof(T) == 1 ? masks[static_cast<unsigned char>(data[k])]
+                                          : 1u << dfa.symbol_class(data[k]);
+            h = h << 8 | own;
+
+            // a symbol outside Σ: no substring in L contains it
+            if (own == foreign)
+                first = r + 1;
+
+            // a full window missing a letter: substrings must start after it
+            if (r + 1 >= window) {
+                uint64_t w = h & windowBytes;
+                w |= w >> 32;
+                w |= w >> 16;
+                w |= w >> 8;
+                if ((w & letters) != letters && r + 2 - window > first)
+                    first = r + 2 - window;
+            }
+
+            // the substrings in L ending at r start at first .. r
+            uint64_t valid = r + 1 - first;
+            sum += valid;
+            if (valid > bestLength) {
+                bestLength = valid;
+                bestOffset = first;
+            }
+        }
+
+        position += end - begin;
+        history = h;
+        earliest = first;
+        total += BigUnsigned(std::to_string(sum));
+    }
+}
+
+
+/** ***************************************************************************
+ * read a whole text from an input stream
+ * @param  in: the stream, read in chunks until its end
+ * @param  chunkSize: number of symbols read at a time
+ * @post   the results describe the stream's text; the analyzer is reset
+ *         first. Throws std::runtime_error if reading fails or the stream
+ *         ends inside a symbol
+ *
+ *****************************************************************************/
+template<typename T>
+void SubstringAnalyzer<T>::analyze(std::istream &in, size_t chunkSize) {
+    reset();
+    std::vector<T> buffer(chunkSize ? chunkSize : 1);
+    while (in) {
+        // a read only comes up short at the end of the stream, so only
+        // the last one can end inside a symbol
+        in.read(reinterpret_cast<char *>(buffer.data()), buffer.size() * sizeof(T));
+        size_t bytes = size_t(in.gcount());
+        if (bytes % sizeof(T) != 0)
+            throw std::runtime_error("SubstringAnalyzer: input ends inside a symbol");
+        if (bytes == 0)
+            break;
+        feed(buffer.data(), bytes / sizeof(T));
+    }
+    if (in.bad())
+        throw std::runtime_error("SubstringAnalyzer: reading the stream failed");
+}
+
+
+/** ***************************************************************************
+ * @return the offset of the longest substring in L, the first one if
+ *  there are several
+ *
+ *****************************************************************************/
+template<typename T>
+uint64_t SubstringAnalyzer<T>::longest_offset() const {
+    return bestOffset;
+}
+
+
+/** ***************************************************************************
+ * @return the length of the longest substring in L, 0 if there is none
+ *
+ *****************************************************************************/
+template<typename T>
+uint64_t SubstringAnalyzer<T>::longest_length() const {
+    return bestLength;
+}
+
+
+/** ***************************************************************************
+ * @return the number of non-empty substrings in L, counting every start
+ *  and end position separately
+ *
+ *****************************************************************************/
+template<typename T>
+BigUnsigned SubstringAnalyzer<T>::count() const {
+    return total;
+}
+
+template class SubstringAnalyzer<char>;
+template class SubstringAnalyzer<unsigned char>;
+template class SubstringAnalyzer<char32_t>;
@@ -0,0 +1,62 @@
+/** ***************************************************************************
+ * @file:   SubstringAnalyzer.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called
+ *  SubstringAnalyzer
+ * @remark: A SubstringAnalyzer reads a text once and reports the longest
+ *  substring that belongs to L and how many (non-empty) substrings, counted
+ *  by position, belong to L. A substring ending at position r is in L
+ *  exactly when it starts after the last symbol outside Σ and after the
+ *  start of the last window of WINDOW symbols, ending at or before r, that
+ *  lacks a letter. That earliest start only moves forward, so one pass
+ *  with constant work per symbol yields both answers, instead of checking
+ *  every substring. The text may arrive in pieces.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_SUBSTRINGANALYZER_HPP
+#define INC_454_P1_SUBSTRINGANALYZER_HPP
+
+
+#include "DFA.hpp"
+#include <cstdint>
+#include <istream>
+#include <vector>
+
+template<typename T>
+class SubstringAnalyzer {
+public:
+    explicit SubstringAnalyzer(const DFA<T> &dfa);
+    void reset();
+    void feed(const T *data, size_t length);
+    void analyze(std::istream &in, size_t chunkSize = 1 << 16);
+
+    uint64_t longest_offset() const;
+    uint64_t longest_length() const;
+    BigUnsigned count() const;
+
+private:
+    const DFA<T> &dfa;
+
+    // the class mask, 1 << symbol_class, of every byte value
+    unsigned char masks[256];
+
+    // number of symbols read, the masks of the last eight symbols (newest
+    // in the low byte), and the earliest start of a substring in L that
+    // ends at the last symbol read
+    uint64_t position;
+    uint64_t history;
+    uint64_t earliest;
+
+    // the longest substring in L found so far
+    uint64_t bestOffset;
+    uint64_t bestLength;
+
+    // number of substrings in L; every block is counted in 64 bits and
+    // then added here
+    BigUnsigned total;
+};
+
+
+#endif //INC_454_P1_SUBSTRINGANALYZER_HPP
@@ -0,0 +1,62 @@
+/** ***************************************************************************
+ * @file:   SymbolView.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains a class called SymbolView and the string
+ *  types of every symbol type
+ * @remark: std::basic_string and std::basic_string_view need
+ *  std::char_traits<T>, which the standard only provides for the
+ *  character types. unsigned char is not one of them, and libc++ no
+ *  longer supplies it, so strings of unsigned char symbols are kept in a
+ *  std::vector and viewed through a SymbolView, a pointer and a length.
+ *  SymbolTypes<T> names the string and view type of a symbol type, the
+ *  standard ones for char and char32_t.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_SYMBOLVIEW_HPP
+#define INC_454_P1_SYMBOLVIEW_HPP
+
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// a read-only view of a run of symbols that does not need char_traits
+template<typename T>
+class SymbolView {
+public:
+    SymbolView() = default;
+    SymbolView(const T *symbols, size_t length)
+        : symbols(symbols), length(length) { }
+    SymbolView(const std::vector<T> &string)
+        : symbols(string.data()), length(string.size()) { }
+
+    const T *data() const { return symbols; }
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+    const T *begin() const { return symbols; }
+    const T *end() const { return symbols + length; }
+    const T &operator [] (size_t i) const { return symbols[i]; }
+
+private:
+    const T *symbols = nullptr;
+    size_t length = 0;
+};
+
+// the owning string and the view of symbols of type T
+template<typename T>
+struct SymbolTypes {
+    typedef std::basic_string<T> String;
+    typedef std::basic_string_view<T> View;
+};
+
+template<>
+struct SymbolTypes<unsigned char> {
+    typedef std::vector<unsigned char> String;
+    typedef SymbolView<unsigned char> View;
+};
+
+
+#endif //INC_454_P1_SYMBOLVIEW_HPP
@@ -0,0 +1,178 @@
+/** ***************************************************************************
+ * @file:   TransitionTable.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  TransitionTable
+ *
+ *****************************************************************************/
+
+#include "TransitionTable.hpp"
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+
+/** ***************************************************************************
+ * TransitionTable constructor - take the tables of a DFA
+ * @param  states: number of states
+ * @param  width: number of symbol classes
+ * @param  start: the start state
+ * @param  next: states * width entries, next[q * width + σ] = δ(q, σ)
+ * @param  accepting: states entries, true for the accepting states
+ *
+ *****************************************************************************/
+TransitionTable::TransitionTable(int states, int width, int start,
+                                 std::vector<int> next,
+                                 std::vector<bool> accepting)
+    : count(states), columns(width), initial(start), table(std::move(next)),
+      final(std::move(accepting)) {
+    if (states <= 0 || width <= 0 || start < 0 || start >= states
+        || table.size() != size_t(states) * width || final.size() != size_t(states))
+        throw std::invalid_argument("TransitionTable: inconsistent tables");
+    for (int target: table)
+        if (target < 0 || target >= states)
+            throw std::invalid_argument("TransitionTable: transition out of range");
+}
+
+
+/** ***************************************************************************
+ * TransitionTable constructor - copy δ of a DFA, symbols outside Σ included
+ * @param  dfa: the DFA M
+ *
+ *****************************************************************************/
+template<typename T>
+TransitionTable::TransitionTable(const DFA<T> &dfa)
+    : TransitionTable(DFA<T>::STATES, dfa.table_width(), DFA<T>::START,
+                      std::vector<int>(dfa.transition_table(),
+                                       dfa.transition_table()
+                                       + DFA<T>::STATES * dfa.table_width()),
+                      std::vector<bool>(DFA<T>::STATES, true)) {
+    final[DFA<T>::DEAD] = false;
+}
+
+
+/** ***************************************************************************
+ * @return the number of states
+ *
+ *****************************************************************************/
+int TransitionTable::states() const {
+    return count;
+}
+
+
+/** ***************************************************************************
+ * @return the number of symbol classes
+ *
+ *****************************************************************************/
+int TransitionTable::width() const {
+    return columns;
+}
+
+
+/** ***************************************************************************
+ * @return the start state
+ *
+ *****************************************************************************/
+int TransitionTable::start() const {
+    return initial;
+}
+
+
+/** ***************************************************************************
+ * @return δ(state, symbol) for a symbol class
+ *
+ *****************************************************************************/
+int TransitionTable::next(int state, int symbol) const {
+    return table[size_t(state) * columns + symbol];
+}
+
+
+/** ***************************************************************************
+ * @return the flat table, δ(q, σ) is at q * width() + σ
+ *
+ *****************************************************************************/
+const int *TransitionTable::data() const {
+    return table.data();
+}
+
+
+/** ***************************************************************************
+ * @return true if state is accepting
+ *
+ *****************************************************************************/
+bool TransitionTable::accepting(int state) const {
+    return final[state];
+}
+
+
+/** ***************************************************************************
+ * merge equivalent states
+ * @remark: Moore's algorithm: start from the partition {F, Q - F} and split
+ *  every block by the blocks its successors lie in, until no block splits.
+ *  The blocks are then numbered by their smallest state, which keeps the
+ *  start state first if it was.
+ *
+ * @param  stateClass: if not nullptr, receives for every state of *this its
+ *         state in the result
+ * @post   return the minimal table for the same language; unreachable
+ *         states are kept
+ *
+ *****************************************************************************/
+TransitionTable TransitionTable::minimized(std::vector<int> *stateClass) const {
+    std::vector<int> block(count);
+    int blocks = 0;
+    {
+        std::map<bool, int> seen;
+        for (int q = 0; q < count; q++)
+            block[q] = seen.emplace(final[q], int(seen.size())).first->second;
+        blocks = int(seen.size());
+    }
+
+    while (true) {
+        std::map<std::vector<int>, int> seen;
+        std::vector<int> signature(columns + 1);
+        std::vector<int> refined(count);
+        for (int q = 0; q < count; q++) {
+            signature[0] = block[q];
+            for (int s = 0; s < columns; s++)
+                signature[s + 1] = block[next(q, s)];
+            refined[q] = seen.emplace(signature, int(seen.size())).first->second;
+        }
+        block.swap(refined);
+        if (int(seen.size()) == blocks)
+            break;
+        blocks = int(seen.size());
+    }
+
+    // blocks are numbered in the order their smallest state appears
+    std::vector<int> number(blocks, -1);
+    std::vector<int> representative;
+    for (int q = 0; q < count; q++) {
+        if (number[block[q]] < 0) {
+            number[block[q]] = int(representative.size());
+            representative.push_back(q);
+        }
+    }
+
+    std::vector<int> next(size_t(blocks) * columns);
+    std::vector<bool> accepting(blocks);
+    for (int b = 0; b < blocks; b++) {
+        int q = representative[b];
+        for (int s = 0; s < columns; s++)
+            next[size_t(b) * columns + s] = number[block[this->next(q, s)]];
+        accepting[b] = final[q];
+    }
+
+    if (stateClass != nullptr) {
+        stateClass->resize(count);
+        for (int q = 0; q < count; q++)
+            (*stateClass)[q] = number[block[q]];
+    }
+    return TransitionTable(blocks, columns, number[block[initial]],
+                           std::move(next), std::move(accepting));
+}
+
+template TransitionTable::TransitionTable(const DFA<char> &dfa);
+template TransitionTable::TransitionTable(const DFA<unsigned char> &dfa);
+template TransitionTable::TransitionTable(const DFA<char32_t> &dfa);
@@ -0,0 +1,51 @@
+/** ***************************************************************************
+ * @file:   TransitionTable.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called
+ *  TransitionTable
+ * @remark: A TransitionTable is a DFA reduced to its bare tables: states
+ *  0 .. states() - 1, symbol classes 0 .. width() - 1, the flat transition
+ *  table and the set of accepting states. It can be taken from a DFA and
+ *  minimized: minimized() merges equivalent states by Moore's partition
+ *  refinement, so structures that store one entry per state, like the
+ *  maps of a TransitionTree, get as small as the language allows. For L
+ *  the 1366 states of δ shrink to 328.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_TRANSITIONTABLE_HPP
+#define INC_454_P1_TRANSITIONTABLE_HPP
+
+
+#include "DFA.hpp"
+#include <vector>
+
+class TransitionTable {
+public:
+    TransitionTable(int states, int width, int start,
+                    std::vector<int> next, std::vector<bool> accepting);
+    template<typename T>
+    explicit TransitionTable(const DFA<T> &dfa);
+
+    int states() const;
+    int width() const;
+    int start() const;
+    int next(int state, int symbol) const;
+    const int *data() const;
+    bool accepting(int state) const;
+
+    TransitionTable minimized(std::vector<int> *stateClass = nullptr) const;
+
+private:
+    int count;
+    int columns;
+    int initial;
+
+    // next[q * columns + σ] = δ(q, σ)
+    std::vector<int> table;
+    std::vector<bool> final;
+};
+
+
+#endif //INC_454_P1_TRANSITIONTABLE_HPP
@@ -0,0 +1,190 @@
+/** ***************************************************************************
+ * @file:   TransitionTree.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  TransitionTree. Leaves past the end of the text hold the identity map.
+ *
+ *****************************************************************************/
+
+#include "TransitionTree.hpp"
+#include <stdexcept>
+
+
+/** ***************************************************************************
+ * TransitionTree constructor
+ * @param  dfa: the DFA M, must outlive the tree
+ * @param  text: the initial text
+ * @param  length: number of symbols
+ *
+ *****************************************************************************/
+template<typename T>
+TransitionTree<T>::TransitionTree(const DFA<T> &dfa, const T *text, size_t length)
+    : dfa(dfa), delta(TransitionTable(dfa).minimized()), text(text, text + length) {
+    if (delta.states() > 65536)
+        throw std::length_error("TransitionTree: too many states for 16-bit maps");
+
+    leaves = 1;
+    while (leaves * BLOCK < length)
+        leaves *= 2;
+    maps.resize(2 * leaves * delta.states());
+    for (size_t b = 0; b < leaves; b++)
+        build_leaf(b);
+    for (size_t k = leaves - 1; k >= 1; k--)
+        build_node(k);
+}
+
+
+/** ***************************************************************************
+ * @return the number of symbols in the text
+ *
+ *****************************************************************************/
+template<typename T>
+size_t TransitionTree<T>::size() const {
+    return text.size();
+}
+
+
+/** ***************************************************************************
+ * @return the symbol at a position
+ * @pre    position < size()
+ *
+ *****************************************************************************/
+template<typename T>
+T TransitionTree<T>::at(size_t position) const {
+    return text[position];
+}
+
+
+/** ***************************************************************************
+ * replace one symbol of the text
+ * @param  position: where to replace, must be < size()
+ * @param  symbol: the new symbol, which may lie outside Σ
+ * @post   the maps of the segments that hold position are recomputed, in
+ *         O(|Q| (BLOCK + log n)) steps
+ *
+ *****************************************************************************/
+template<typename T>
+void TransitionTree<T>::assign(size_t position, T symbol) {
+    if (position >= text.size())
+        throw std::out_of_range("TransitionTree::assign: position past the end");
+    text[position] = symbol;
+    size_t node = leaves + position / BLOCK;
+    build_leaf(position / BLOCK);
+    for (node /= 2; node >= 1; node /= 2)
+        build_node(node);
+}
+
+
+/** ***************************************************************************
+ * @return true if the whole text is in L
+ *
+ *****************************************************************************/
+template<typename T>
+bool TransitionTree<T>::accepts() const {
+    return delta.accepting(map(1)[delta.start()]);
+}
+
+
+/** ***************************************************************************
+ * @param  begin: first position of the range
+ * @param  end: one past the last position, begin <= end <= size()
+ * @return true if the symbols in [begin, end) form a string in L
+ *
+ *****************************************************************************/
+template<typename T>
+bool TransitionTree<T>::accepts(size_t begin, size_t end) const {
+    if (begin > end || end > text.size())
+        throw std::out_of_range("TransitionTree::accepts: invalid range");
+
+    // symbols of partial blocks are run one by one, whole blocks through
+    // the tree
+    int state = delta.start();
+    size_t first = (begin + BLOCK - 1) / BLOCK;
+    size_t last = end / BLOCK;
+    if (first >= last) {
+        for (size_t i = begin; i < end; i++)
+            state = delta.next(state, dfa.symbol_class(text[i]));
+        return delta.accepting(state);
+    }
+    for (size_t i = begin; i < first * BLOCK; i++)
+        state = delta.next(state, dfa.symbol_class(text[i]));
+    state = run(1, 0, leaves, first, last, state);
+    for (size_t i = last * BLOCK; i < end; i++)
+        state = delta.next(state, dfa.symbol_class(text[i]));
+    return delta.accepting(state);
+}
+
+
+/** ***************************************************************************
+ * apply the maps of the blocks [begin, end) within a node to a state
+ * @param  node: the node, which covers the blocks [low, high)
+ * @post   return the state reached
+ *
+ *****************************************************************************/
+template<typename T>
+int TransitionTree<T>::run(size_t node, size_t low, size_t high,
+                           size_t begin, size_t end, int state) const {
+    if (end <= low || high <= begin)
+        return state;
+    if (begin <= low && high <= end)
+        return map(node)[state];
+    size_t middle = (low + high) / 2;
+    state = run(2 * node, low, middle, begin, end, state);
+    return run(2 * node + 1, middle, high, begin, end, state);
+}
+
+
+/** ***************************************************************************
+ * @return the map of a node
+ *
+ *****************************************************************************/
+template<typename T>
+const uint16_t *TransitionTree<T>::map(size_t node) const {
+    return maps.data() + node * delta.states();
+}
+
+template<typename T>
+uint16_t *TransitionTree<T>::map(size_t node) {
+    return maps.data() + node * delta.states();
+}
+
+
+/** ***************************************************************************
+ * recompute the map of a leaf from the symbols of its block
+ *
+ *****************************************************************************/
+template<typename T>
+void TransitionTree<T>::build_leaf(size_t leaf) {
+    uint16_t *out = map(leaves + leaf);
+    const int states = delta.states();
+    const int width = delta.width();
+    for (int q = 0; q < states; q++)
+        out[q] = uint16_t(q);
+
+    size_t begin = leaf * BLOCK;
+    size_t end = begin + BLOCK < text.size() ? begin + BLOCK : text.size();
+    for (size_t i = begin; i < end; i++) {
+        const int *column = delta.data() + dfa.symbol_class(text[i]);
+        for (int q = 0; q < states; q++)
+            out[q] = uint16_t(column[size_t(out[q]) * width]);
+    }
+}
+
+
+/** ***************************************************************************
+ * recompute the map of an inner node: first its left child, then its right
+ *
+ *****************************************************************************/
+template<typename T>
+void TransitionTree<T>::build_node(size_t node) {
+    const uint16_t *left = map(2 * node);
+    const uint16_t *right = map(2 * node + 1);
+    uint16_t *out = map(node);
+    for (int q = 0; q < delta.states(); q++)
+        out[q] = right[left[q]];
+}
+
+template class TransitionTree<char>;
+template class TransitionTree<unsigned char>;
+template class TransitionTree<char32_t>;
@@ -0,0 +1,67 @@
+/** ***************************************************************************
+ * @file:   TransitionTree.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called
+ *  TransitionTree
+ * @remark: A TransitionTree keeps a text in memory and answers whether the
+ *  whole text, or any range of it, is in L while single symbols of the
+ *  text are replaced. Running M over a string is applying the map
+ *  q -> δ*(q, string) to q₀, and the map of a concatenation is the
+ *  composition of the maps of its parts. The tree stores the map of the
+ *  minimized δ for every segment of a segment tree over the text: a
+ *  replacement recomputes the maps on one leaf-to-root path, and a query
+ *  applies O(log n) stored maps to a single state.
+ *
+ *  The leaves are blocks of BLOCK symbols rather than single symbols, which
+ *  divides the memory of the maps by BLOCK; a leaf map is rebuilt from
+ *  the columns of δ.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_TRANSITIONTREE_HPP
+#define INC_454_P1_TRANSITIONTREE_HPP
+
+
+#include "DFA.hpp"
+#include "TransitionTable.hpp"
+#include <cstdint>
+#include <vector>
+
+template<typename T>
+class TransitionTree {
+public:
+    static constexpr size_t BLOCK = 16;
+
+    TransitionTree(const DFA<T> &dfa, const T *text, size_t length);
+    size_t size() const;
+    T at(size_t position) const;
+    void assign(size_t position, T symbol);
+    bool accepts() const;
+    bool accepts(size_t begin, size_t end) const;
+
+private:
+    const uint16_t *map(size_t node) const;
+    uint16_t *map(size_t node);
+    void build_leaf(size_t leaf);
+    void build_node(size_t node);
+    int run(size_t node, size_t low, size_t high, size_t begin, size_t end,
+            int state) const;
+
+    const DFA<T> &dfa;
+
+    // the minimized δ
+    TransitionTable delta;
+
+    std::vector<T> text;
+
+    // number of leaves, a power of two; node 1 is the root, the children
+    // of node k are 2k and 2k + 1 and leaf b is node leaves + b
+    size_t leaves;
+
+    // the map of node k is maps[k * states .. (k + 1) * states)
+    std::vector<uint16_t> maps;
+};
+
+
+#endif //INC_454_P1_TRANSITIONTREE_HPP
@@ -0,0 +1,121 @@
+/** ***************************************************************************
+ * @file:   ViolationReporter.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  ViolationReporter. The window ending at the newest symbol is the low
+ *  WINDOW bytes of the history word; OR-ing them together gives the set of
+ *  symbol classes the window holds. This needs |Σ| + 1 <= 8 classes.
+ *
+ *****************************************************************************/
+
+#include "ViolationReporter.hpp"
+#include <stdexcept>
+
+// records passed to a callback per batch
+static const size_t BATCH = 4096;
+
+
+/** ***************************************************************************
+ * ViolationReporter constructor
+ * @param  dfa: the DFA M whose alphabet is checked, must outlive the
+ *         reporter and reject symbols outside Σ
+ *
+ *****************************************************************************/
+template<typename T>
+ViolationReporter<T>::ViolationReporter(const DFA<T> &dfa)
+    : dfa(dfa), symbols(dfa.table_width() - 1) {
+    if (dfa.unknown_symbols() != DFA<T>::UnknownSymbol::REJECT)
+        throw std::invalid_argument("ViolationReporter: the DFA must reject unknown symbols");
+    for (int byte = 0; byte < 256; byte++)
+        masks[byte] = 1u << dfa.symbol_classes()[byte];
+    reset();
+}
+
+
+/** ***************************************************************************
+ * forget all input and start again at offset 0
+ *
+ *****************************************************************************/
+template<typename T>
+void ViolationReporter<T>::reset() {
+    position = 0;
+    history = 0;
+}
+
+
+/** ***************************************************************************
+ * @return the bit of Violation::missing that marks symbols outside Σ
+ *
+ *****************************************************************************/
+template<typename T>
+uint32_t ViolationReporter<T>::foreign_bit() const {
+    return 1u << symbols;
+}
+
+
+/** ***************************************************************************
+ * read the next piece of the input and write a record for every window
+ *  that ends in it and is not in L
+ * @param  data: the symbols
+ * @param  length: number of symbols
+ * @param  out: room for at least length records
+ * @post   return the number of records written, in order of offset
+ *
+ *****************************************************************************/
+template<typename T>
+size_t ViolationReporter<T>::feed(const T *data, size_t length, Violation *out) {
+    static_assert(DFA<T>::WINDOW <= 8, "the window must fit in the history word");
+    const uint64_t windowBytes = (uint64_t(1) << (8 * DFA<T>::WINDOW)) - 1;
+    // a window is fine when it has every letter and no foreign symbol
+    const uint32_t letters = dfa.letter_mask();
+    const uint32_t report = letters | foreign_bit();
+    uint64_t h = history;
+    size_t written = 0;
+
+    for (size_t k = 0; k < length; k++) {
+        h = h << 8 | (sizeof(T) == 1 ? masks[static_cast<unsigned char>(data[k])]
+                                     : 1u << dfa.symbol_class(data[k]));
+
+        // fold the bytes of the window into the low byte
+        uint64_t w = h & windowBytes;
+        w |= w >> 32;
+        w |= w >> 16;
+        w |= w >> 8;
+        uint32_t missing = (uint32_t(w & 0xFF) ^ letters) & report;
+
+        // the record is written every time but only kept if it reports
+        // something, and only once the first window is complete
+        out[written] = Violation{position + k + 1 - DFA<T>::WINDOW, missing};
+        written += missing != 0 && position + k + 1 >= DFA<T>::WINDOW;
+    }
+
+    history = h;
+    position += length;
+    return written;
+}
+
+
+/** ***************************************************************************
+ * read the next piece of the input and pass a record for every window
+ *  that ends in it and is not in L to a callback
+ * @param  data: the symbols
+ * @param  length: number of symbols
+ * @param  report: called once per record, in order of offset
+ *
+ *****************************************************************************/
+template<typename T>
+void ViolationReporter<T>::feed(const T *data, size_t length,
+                                const Callback &report) {
+    pending.resize(BATCH);
+    for (size_t i = 0; i < length; i += BATCH) {
+        size_t count = feed(data + i, length - i < BATCH ? length - i : BATCH,
+                            pending.data());
+        for (size_t k = 0; k < count; k++)
+            report(pending[k]);
+    }
+}
+
+template class ViolationReporter<char>;
+template class ViolationReporter<unsigned char>;
+template class ViolationReporter<char32_t>;
@@ -0,0 +1,63 @@
+/** ***************************************************************************
+ * @file:   ViolationReporter.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called
+ *  ViolationReporter
+ * @remark: Where a StreamMatcher stops at the first symbol that takes an
+ *  input out of L, a ViolationReporter lists every offending window: every
+ *  substring of length DFA<T>::WINDOW that lacks a letter of Σ, together
+ *  with the letters it lacks. Each symbol becomes a one-bit mask of its
+ *  symbol class, and the masks of the last WINDOW symbols are kept side by
+ *  side in one 64-bit word, so one pass with a few register operations
+ *  per symbol decides every window, and the input may arrive in pieces.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_VIOLATIONREPORTER_HPP
+#define INC_454_P1_VIOLATIONREPORTER_HPP
+
+
+#include "DFA.hpp"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// one offending window
+struct Violation {
+    // offset of the first symbol of the window
+    uint64_t offset;
+    // bit i is set if the i-th letter of Σ is missing from the window; bit
+    // |Σ| (FOREIGN) is set if the window holds a symbol outside Σ
+    uint32_t missing;
+};
+
+template<typename T>
+class ViolationReporter {
+public:
+    typedef std::function<void(const Violation &violation)> Callback;
+
+    explicit ViolationReporter(const DFA<T> &dfa);
+    void reset();
+    size_t feed(const T *data, size_t length, Violation *out);
+    void feed(const T *data, size_t length, const Callback &report);
+    uint32_t foreign_bit() const;
+
+private:
+    const DFA<T> &dfa;
+    unsigned symbols;
+
+    // the class mask, 1 << symbol_class, of every byte value
+    unsigned char masks[256];
+
+    // number of symbols read, and the masks of the last eight symbols,
+    // the newest in the low byte
+    uint64_t position;
+    uint64_t history;
+
+    // records for the callback form of feed
+    std::vector<Violation> pending;
+};
+
+
+#endif //INC_454_P1_VIOLATIONREPORTER_HPP
@@ -0,0 +1,129 @@
+/** ***************************************************************************
+ * @file:   WeightedCounter.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  WeightedCounter
+ *
+ *****************************************************************************/
+
+#include "WeightedCounter.hpp"
+#include "CountTable.hpp"
+#include <stdexcept>
+
+
+/** ***************************************************************************
+ * WeightedCounter constructor
+ * @param  dfa: the DFA M
+ *
+ *****************************************************************************/
+template<typename T>
+WeightedCounter::WeightedCounter(const DFA<T> &dfa)
+    : delta(TransitionTable(dfa).minimized()), symbols(dfa.table_width() - 1) { }
+
+
+/** ***************************************************************************
+ * @return the number of letters, the length of every distribution or list
+ *  of weights, in the order of Σ
+ *
+ *****************************************************************************/
+int WeightedCounter::letters() const {
+    return symbols;
+}
+
+
+/** ***************************************************************************
+ * @param  n: the length, n >= 0
+ * @param  distribution: the probability of every letter; whatever they
+ *         leave to 1 is the probability of symbols outside Σ
+ * @return the probability that a random string of length n is in L
+ *
+ *****************************************************************************/
+double WeightedCounter::probability(int n, const std::vector<double> &distribution) const {
+    return probabilities(n, {distribution})[0];
+}
+
+
+/** ***************************************************************************
+ * compute the acceptance probability for many distributions at once
+ * @param  n: the length, n >= 0
+ * @param  distributions: one probability per letter for each distribution
+ * @post   return one probability per distribution
+ *
+ *****************************************************************************/
+std::vector<double> WeightedCounter::probabilities(
+        int n, const std::vector<std::vector<double>> &distributions) const {
+    if (n < 0)
+        throw std::invalid_argument("WeightedCounter: negative length");
+    const size_t count = distributions.size();
+    const int states = delta.states();
+
+    // weight[s * count + d] is the probability of letter s in distribution d
+    std::vector<double> weight(symbols * count);
+    for (size_t d = 0; d < count; d++) {
+        if (distributions[d].size() != size_t(symbols))
+            throw std::invalid_argument("WeightedCounter: one probability per letter needed");
+        for (int s = 0; s < symbols; s++) {
+            if (!(distributions[d][s] >= 0))
+                throw std::invalid_argument("WeightedCounter: negative probability");
+            weight[s * count + d] = distributions[d][s];
+        }
+    }
+
+    // entry q * count + d holds W(q, k) for distribution d, so the inner
+    // loop runs over the distributions with δ(q, σ) fixed
+    std::vector<double> previous(states * count), current(states * count);
+    for (int q = 0; q < states; q++)
+        for (size_t d = 0; d < count; d++)
+            current[q * count + d] = delta.accepting(q) ? 1 : 0;
+
+    for (int k = 0; k < n; k++) {
+        previous.swap(current);
+        for (int q = 0; q < states; q++) {
+            double *out = current.data() + q * count;
+            for (size_t d = 0; d < count; d++)
+                out[d] = 0;
+            for (int s = 0; s < symbols; s++) {
+                const double *in = previous.data() + delta.next(q, s) * count;
+                const double *w = weight.data() + s * count;
+                for (size_t d = 0; d < count; d++)
+                    out[d] += w[d] * in[d];
+            }
+        }
+    }
+
+    const double *start = current.data() + delta.start() * count;
+    return std::vector<double>(start, start + count);
+}
+
+
+/** ***************************************************************************
+ * @param  n: the length, n >= 0
+ * @param  weights: the weight of every letter
+ * @return the sum of the weights of the strings of length n in L
+ *
+ *****************************************************************************/
+BigUnsigned WeightedCounter::weighted_count(int n, const std::vector<unsigned> &weights) const {
+    if (n < 0)
+        throw std::invalid_argument("WeightedCounter: negative length");
+    if (weights.size() != size_t(symbols))
+        throw std::invalid_argument("WeightedCounter: one weight per letter needed");
+    const int states = delta.states();
+
+    std::vector<BigUnsigned> previous(states), current(states);
+    for (int q = 0; q < states; q++)
+        current[q] = BigUnsigned(delta.accepting(q) ? 1 : 0);
+
+    // the rows of CountTable with weights, two at a time: a single count
+    // needs no table of every length
+    for (int k = 0; k < n; k++) {
+        previous.swap(current);
+        CountTable<BigUnsigned>::step(delta, symbols, previous, current,
+                                      weights.data());
+    }
+    return current[delta.start()];
+}
+
+template WeightedCounter::WeightedCounter(const DFA<char> &dfa);
+template WeightedCounter::WeightedCounter(const DFA<unsigned char> &dfa);
+template WeightedCounter::WeightedCounter(const DFA<char32_t> &dfa);
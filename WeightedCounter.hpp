@@ -0,0 +1,49 @@
+/** ***************************************************************************
+ * @file:   WeightedCounter.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called
+ *  WeightedCounter
+ * @remark: A WeightedCounter answers the counting question for inputs that
+ *  are not uniform over Σ. Each letter σ gets a weight w(σ), and the
+ *  weight of a string is the product of the weights of its letters. The
+ *  counting DP then becomes
+ *      W(q, 0) = 1 if q ∈ F, else 0
+ *      W(q, k) = Σ over letters σ of w(σ) W(δ(q, σ), k - 1)
+ *  With probabilities as weights, W(q₀, n) is the probability that a
+ *  random string of length n is in L; with integer weights it is the
+ *  exact weighted count, which is the plain count when every weight is 1.
+ *
+ *  Probabilities are computed in double, and a batch of distributions
+ *  shares one pass over δ per step. Weighted counts take the rows of
+ *  CountTable::step with the weights, which uses
+ *  BigUnsigned::multiply_add_all, one carry pass per entry.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_WEIGHTEDCOUNTER_HPP
+#define INC_454_P1_WEIGHTEDCOUNTER_HPP
+
+
+#include "DFA.hpp"
+#include "TransitionTable.hpp"
+#include <vector>
+
+class WeightedCounter {
+public:
+    template<typename T>
+    explicit WeightedCounter(const DFA<T> &dfa);
+    int letters() const;
+    double probability(int n, const std::vector<double> &distribution) const;
+    std::vector<double> probabilities(
+        int n, const std::vector<std::vector<double>> &distributions) const;
+    BigUnsigned weighted_count(int n, const std::vector<unsigned> &weights) const;
+
+private:
+    // the minimized δ
+    TransitionTable delta;
+    int symbols;
+};
+
+
+#endif //INC_454_P1_WEIGHTEDCOUNTER_HPP
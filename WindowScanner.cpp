@@ -0,0 +1,270 @@
+/** ***************************************************************************
+ * @file:   WindowScanner.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @remark: This file contains the implementation of a class called
+ *  WindowScanner. The input is handled in blocks: the masks of a block are
+ *  written after the last WINDOW - 1 masks of the block before it, so the
+ *  window ending at every position of the block can be read with plain
+ *  unaligned loads. Before the first block those slots hold the full mask,
+ *  which makes the windows that would reach past the start of the input
+ *  pass, as L requires nothing of strings shorter than WINDOW.
+ *
+ *****************************************************************************/
+
+#include "WindowScanner.hpp"
+#include <cstring> // for std::memcpy
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define WINDOWSCANNER_X86 1
+#include <immintrin.h>
+#endif
+
+// positions handled per block, room for vector loads past its end, and
+// the longest window the block buffer has room for
+static const size_t BLOCK = 4096;
+static const size_t SLACK = 64;
+static const int MAX_WINDOW = 64;
+
+
+/** ***************************************************************************
+ * the scalar kernels
+ *
+ *****************************************************************************/
+static void masks_scalar(const uint8_t *table, const unsigned char *data,
+                         size_t begin, size_t length, uint8_t *out) {
+    for (size_t i = begin; i < length; i++)
+        out[i] = table[data[i]];
+}
+
+static size_t windows_scalar(const uint8_t *masks, size_t begin, size_t length,
+                             int window, uint8_t full) {
+    // masks[i + window - 1] belongs to position i
+    if (window <= 8) {
+        // keep the last eight masks in one word, the newest in the low byte
+        const uint64_t windowBytes = window == 8 ? ~uint64_t(0)
+                                   : (uint64_t(1) << (8 * window)) - 1;
+        uint64_t h = 0;
+        for (int k = 0; k < window - 1; k++)
+            h = h << 8 | masks[begin + k];
+        for (size_t i = begin; i < length; i++) {
+            uint8_t own = masks[i + window - 1];
+            h = h << 8 | own;
+            uint64_t w = h & windowBytes;
+            w |= w >> 32;
+            w |= w >> 16;
+            w |= w >> 8;
+            if (uint8_t(w) != full || own == 0)
+                return i;
+        }
+        return length;
+    }
+
+    for (size_t i = begin; i < length; i++) {
+        uint8_t w = 0;
+        for (int k = 0; k < window; k++)
+            w |= masks[i + k];
+        if (w != full || masks[i + window - 1] == 0)
+            return i;
+    }
+    return length;
+}
+
+#ifdef WINDOWSCANNER_X86
+__attribute__((target("avx2")))
+static void masks_avx2(const uint8_t *table, const uint8_t *low,
+                       const uint8_t *high, const unsigned char *data,
+                       size_t length, uint8_t *out) {
+    const __m256i lowTable = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)low));
+    const __m256i highTable = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)high));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        __m256i b = _mm256_loadu_si256((const __m256i *)(data + i));
+        __m256i lo = _mm256_shuffle_epi8(lowTable, _mm256_and_si256(b, nibble));
+        __m256i hi = _mm256_shuffle_epi8(highTable,
+            _mm256_and_si256(_mm256_srli_epi16(b, 4), nibble));
+        _mm256_storeu_si256((__m256i *)(out + i), _mm256_and_si256(lo, hi));
+    }
+    masks_scalar(table, data, i, length, out);
+}
+
+__attribute__((target("avx2")))
+static size_t windows_avx2(const uint8_t *masks, size_t length, int window,
+                           uint8_t full) {
+    const __m256i fullMask = _mm256_set1_epi8(char(full));
+    const __m256i zero = _mm256_setzero_si256();
+
+    for (size_t i = 0; i < length; i += 32) {
+        __m256i w = zero;
+        for (int k = 0; k < window; k++)
+            w = _mm256_or_si256(w, _mm256_loadu_si256((const __m256i *)(masks + i + k)));
+        __m256i own = _mm256_loadu_si256((const __m256i *)(masks + i + window - 1));
+        __m256i good = _mm256_andnot_si256(_mm256_cmpeq_epi8(own, zero),
+                                           _mm256_cmpeq_epi8(w, fullMask));
+        uint32_t bad = ~uint32_t(_mm256_movemask_epi8(good));
+        if (length - i < 32)
+            bad &= (uint32_t(1) << (length - i)) - 1;
+        if (bad != 0)
+            return i + __builtin_ctz(bad);
+    }
+    return length;
+}
+
+__attribute__((target("ssse3")))
+static void masks_ssse3(const uint8_t *table, const uint8_t *low,
+                        const uint8_t *high, const unsigned char *data,
+                        size_t length, uint8_t *out) {
+    const __m128i lowTable = _mm_loadu_si128((const __m128i *)low);
+    const __m128i highTable = _mm_loadu_si128((const __m128i *)high);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i b = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i lo = _mm_shuffle_epi8(lowTable, _mm_and_si128(b, nibble));
+        __m128i hi = _mm_shuffle_epi8(highTable,
+            _mm_and_si128(_mm_srli_epi16(b, 4), nibble));
+        _mm_storeu_si128((__m128i *)(out + i), _mm_and_si128(lo, hi));
+    }
+    masks_scalar(table, data, i, length, out);
+}
+
+__attribute__((target("ssse3")))
+static size_t windows_ssse3(const uint8_t *masks, size_t length, int window,
+                            uint8_t full) {
+    const __m128i fullMask = _mm_set1_epi8(char(full));
+    const __m128i zero = _mm_setzero_si128();
+
+    for (size_t i = 0; i < length; i += 16) {
+        __m128i w = zero;
+        for (int k = 0; k < window; k++)
+            w = _mm_or_si128(w, _mm_loadu_si128((const __m128i *)(masks + i + k)));
+        __m128i own = _mm_loadu_si128((const __m128i *)(masks + i + window - 1));
+        __m128i good = _mm_andnot_si128(_mm_cmpeq_epi8(own, zero),
+                                        _mm_cmpeq_epi8(w, fullMask));
+        uint32_t bad = ~uint32_t(_mm_movemask_epi8(good)) & 0xFFFFu;
+        if (length - i < 16)
+            bad &= (uint32_t(1) << (length - i)) - 1;
+        if (bad != 0)
+            return i + __builtin_ctz(bad);
+    }
+    return length;
+}
+
+enum Kernel { SCALAR, SSSE3, AVX2 };
+
+static Kernel best_kernel() {
+    static const Kernel kernel = __builtin_cpu_supports("avx2") ? AVX2
+        : __builtin_cpu_supports("ssse3") ? SSSE3 : SCALAR;
+    return kernel;
+}
+#endif
+
+
+/** ***************************************************************************
+ * WindowScanner constructor
+ * @param  classes: the symbol class of each of the 256 byte values
+ * @param  symbols: |Σ|; classes at or above it mark bytes outside Σ
+ * @param  window: length of the substrings that must hold every letter
+ * @pre    supported(symbols), 1 <= window <= 64
+ *
+ *****************************************************************************/
+WindowScanner::WindowScanner(const unsigned char *classes, unsigned symbols,
+                             int window) : window(window) {
+    full = uint8_t((1u << symbols) - 1);
+    for (int i = 0; i < 16; i++)
+        low[i] = high[i] = 0;
+
+    for (int byte = 0; byte < 256; byte++) {
+        masks[byte] = classes[byte] < symbols ? uint8_t(1u << classes[byte]) : 0;
+        low[byte & 15] |= masks[byte];
+        high[byte >> 4] |= masks[byte];
+    }
+
+    // the nibble split is exact when a class never needs a low nibble of
+    // one of its bytes together with the high nibble of another
+    exact = true;
+    for (int byte = 0; byte < 256; byte++)
+        if ((low[byte & 15] & high[byte >> 4]) != masks[byte])
+            exact = false;
+}
+
+
+/** ***************************************************************************
+ * @return true if an alphabet of the given size fits the one-hot masks
+ *
+ *****************************************************************************/
+bool WindowScanner::supported(unsigned symbols) {
+    return symbols >= 1 && symbols <= 8;
+}
+
+
+/** ***************************************************************************
+ * map a block of bytes to class masks
+ *
+ *****************************************************************************/
+void WindowScanner::compute_masks(const unsigned char *data, size_t length,
+                                  uint8_t *out) const {
+#ifdef WINDOWSCANNER_X86
+    if (exact && best_kernel() == AVX2)
+        return masks_avx2(masks, low, high, data, length, out);
+    if (exact && best_kernel() == SSSE3)
+        return masks_ssse3(masks, low, high, data, length, out);
+#endif
+    masks_scalar(masks, data, 0, length, out);
+}
+
+
+/** ***************************************************************************
+ * find the first position of a block whose window or symbol is not fine
+ * @param  masks: WINDOW - 1 masks before the block, then its masks
+ * @param  length: number of positions in the block
+ * @post   return the position, or length if there is none
+ *
+ *****************************************************************************/
+size_t WindowScanner::check_windows(const uint8_t *masks, size_t length) const {
+#ifdef WINDOWSCANNER_X86
+    if (best_kernel() == AVX2)
+        return windows_avx2(masks, length, window, full);
+    if (best_kernel() == SSSE3)
+        return windows_ssse3(masks, length, window, full);
+#endif
+    return windows_scalar(masks, 0, length, window, full);
+}
+
+
+/** ***************************************************************************
+ * find the first symbol at which a string stops being in L
+ * @param  data: the string
+ * @param  length: number of symbols
+ * @post   return the offset of the first symbol that is outside Σ or ends
+ *         a window of WINDOW symbols missing a letter, or length if the
+ *         string is in L
+ *
+ *****************************************************************************/
+size_t WindowScanner::first_violation(const unsigned char *data,
+                                      size_t length) const {
+    uint8_t buffer[MAX_WINDOW - 1 + BLOCK + SLACK];
+    uint8_t *blockMasks = buffer + window - 1;
+    for (int k = 0; k < window - 1; k++)
+        buffer[k] = full;
+
+    for (size_t start = 0; start < length; start += BLOCK) {
+        size_t n = length - start < BLOCK ? length - start : BLOCK;
+        compute_masks(data + start, n, blockMasks);
+        // the vector kernels may look at up to SLACK masks past the block
+        std::memset(blockMasks + n, full, SLACK);
+
+        size_t p = check_windows(buffer, n);
+        if (p < n)
+            return start + p;
+
+        // keep the masks the next block's first windows reach back to
+        std::memmove(buffer, blockMasks + n - (window - 1), window - 1);
+    }
+    return length;
+}
@@ -0,0 +1,53 @@
+/** ***************************************************************************
+ * @file:   WindowScanner.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the interface of a class called WindowScanner
+ * @remark: A WindowScanner decides membership in L data-parallel instead of
+ *  one state at a time. Every byte is mapped to a one-hot mask of its
+ *  symbol class (0 for bytes outside Σ); the masks of WINDOW consecutive
+ *  positions are OR-ed together, and a window is fine exactly when the
+ *  result holds every letter. With AVX2 (32 positions per step) or SSSE3
+ *  (16 positions per step) the byte-to-mask mapping is two nibble table
+ *  shuffles and the OR is a handful of shifted loads; other processors use
+ *  a scalar loop. Any alphabet of at most 8 symbols works, as the mapping
+ *  comes from the DFA's symbol classes.
+ *
+ *  The DFA stays the reference: the scanner reports the same first
+ *  violation a StreamMatcher run through δ would.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_WINDOWSCANNER_HPP
+#define INC_454_P1_WINDOWSCANNER_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+
+class WindowScanner {
+public:
+    WindowScanner(const unsigned char *classes, unsigned symbols, int window);
+    size_t first_violation(const unsigned char *data, size_t length) const;
+    static bool supported(unsigned symbols);
+
+private:
+    void compute_masks(const unsigned char *data, size_t length,
+                       uint8_t *masks) const;
+    size_t check_windows(const uint8_t *masks, size_t length) const;
+
+    int window;
+    uint8_t full;
+
+    // one-hot class mask of every byte value, 0 outside Σ
+    uint8_t masks[256];
+
+    // the same mapping split by nibble: the mask of byte b is
+    // low[b & 15] & high[b >> 4], when exact is true
+    uint8_t low[16];
+    uint8_t high[16];
+    bool exact;
+};
+
+
+#endif //INC_454_P1_WINDOWSCANNER_HPP
@@ -0,0 +1,66 @@
+/** ***************************************************************************
+ * @file:   ApproximateCounterTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of ApproximateCounter against the exact counts
+ *
+ *****************************************************************************/
+
+#include "ApproximateCounter.hpp"
+#include "TestSupport.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+
+/** ***************************************************************************
+ * @return log10 of a positive number given by its decimal digits
+ *
+ *****************************************************************************/
+static long double log10_of(const std::string &digits) {
+    size_t leading = digits.size() < 19 ? digits.size() : 19;
+    long double head = std::strtold(digits.substr(0, leading).c_str(), nullptr);
+    return std::log10(head) + (digits.size() - leading);
+}
+
+
+/** ***************************************************************************
+ * the estimates agree with the exact counts to nearly long double
+ *  precision, before and after the power iteration has converged
+ *
+ *****************************************************************************/
+static void test_against_exact() {
+    DFA<char> dfa;
+    ApproximateCounter counter(dfa);
+    for (int n = 0; n <= 300; n += n < 20 ? 1 : 37) {
+        std::string exact = text(counter.exact(n));
+        CHECK(n > 9 || exact == std::to_string(brute_count(n)));
+        CHECK(std::fabs(counter.log10_count(n) - log10_of(exact)) < 1e-13L);
+    }
+
+    Estimate small = counter.count(6);
+    CHECK(small.exponent == 3);
+    CHECK(std::fabs(small.mantissa - 1.56L) < 1e-12L);
+    CHECK(small.to_string(3) == "1.56e+3");
+    CHECK(counter.count(0).to_string() == "1.00000e+0");
+
+    // the count grows by λ per symbol, far beyond the steps that were run
+    long double rate = std::log10(counter.growth_rate());
+    CHECK(std::fabs(log10_of(text(counter.exact(300))) - log10_of(text(counter.exact(299)))
+                    - rate) < 1e-13L);
+    const int64_t far = 1000000000000;
+    CHECK(std::fabs(counter.log10_count(far + 1) - counter.log10_count(far) - rate)
+          < 1e-6L);
+    CHECK(counter.count(far).exponent > 0);
+    CHECK(counter.growth_rate() > 1 && counter.growth_rate() < 4);
+
+    CHECK_THROWS(counter.count(-1), std::invalid_argument);
+    CHECK_THROWS(counter.exact(-1), std::invalid_argument);
+}
+
+
+int main() {
+    test_against_exact();
+    return report("ApproximateCounterTest");
+}
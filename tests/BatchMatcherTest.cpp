@@ -0,0 +1,84 @@
+/** ***************************************************************************
+ * @file:   BatchMatcherTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of BatchMatcher against the oracle for L
+ *
+ *****************************************************************************/
+
+#include "BatchMatcher.hpp"
+#include "TestSupport.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+/** ***************************************************************************
+ * @return bit i of a bitmap
+ *
+ *****************************************************************************/
+static bool bit(const std::vector<uint8_t> &bitmap, size_t i) {
+    return (bitmap[i / 8] >> (i % 8)) & 1;
+}
+
+
+/** ***************************************************************************
+ * batches of every short string and of random strings of mixed lengths,
+ *  through both forms of match
+ *
+ *****************************************************************************/
+static void test_batches() {
+    DFA<char> dfa;
+    BatchMatcher<char> matcher(dfa);
+
+    std::vector<std::string> strings;
+    for (int n = 0; n <= 7; n++)
+        for (const std::string &w : all_strings(n, "abcx"))
+            strings.push_back(w);
+    TestRandom random(35);
+    for (int i = 0; i < 1000; i++)
+        strings.push_back(random.word(random.below(60), i % 4 ? "abcd" : "abcdx"));
+
+    // batch sizes that do and do not fill the last group of lanes
+    for (size_t count : {size_t(0), size_t(1), size_t(BatchMatcher<char>::LANES),
+                         size_t(37), strings.size()}) {
+        std::string buffer;
+        std::vector<size_t> offsets{0};
+        std::vector<std::string_view> views;
+        for (size_t i = 0; i < count; i++) {
+            buffer += strings[i];
+            offsets.push_back(buffer.size());
+        }
+        for (size_t i = 0; i < count; i++)
+            views.push_back(std::string_view(buffer).substr(offsets[i],
+                                                            strings[i].size()));
+
+        std::vector<uint8_t> byOffsets((count + 7) / 8 + 1, 0xFF);
+        std::vector<uint8_t> byViews((count + 7) / 8 + 1, 0xFF);
+        matcher.match(buffer.data(), offsets.data(), count, byOffsets.data());
+        matcher.match(views, byViews.data());
+        for (size_t i = 0; i < count; i++) {
+            CHECK(bit(byOffsets, i) == in_language(strings[i]));
+            CHECK(bit(byViews, i) == in_language(strings[i]));
+        }
+    }
+
+    DFA<char32_t> wide;
+    BatchMatcher<char32_t> wideMatcher(wide);
+    std::u32string buffer;
+    std::vector<size_t> offsets{0};
+    for (size_t i = 0; i < 100; i++) {
+        buffer += std::u32string(strings[i + 500].begin(), strings[i + 500].end());
+        offsets.push_back(buffer.size());
+    }
+    std::vector<uint8_t> accepted(13);
+    wideMatcher.match(buffer.data(), offsets.data(), 100, accepted.data());
+    for (size_t i = 0; i < 100; i++)
+        CHECK(bit(accepted, i) == in_language(strings[i + 500]));
+}
+
+
+int main() {
+    test_batches();
+    return report("BatchMatcherTest");
+}
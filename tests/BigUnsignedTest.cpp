@@ -0,0 +1,243 @@
+/** ***************************************************************************
+ * @file:   BigUnsignedTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of BigUnsigned against 64-bit arithmetic and decimal text
+ *
+ *****************************************************************************/
+
+#include "BigUnsigned.hpp"
+#include "TestSupport.hpp"
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+/** ***************************************************************************
+ * parsing from views and streams: white space, leading zeros, long inputs
+ *
+ *****************************************************************************/
+static void test_parsing() {
+    CHECK(text(BigUnsigned(std::string_view(""))) == "0");
+    CHECK(text(BigUnsigned(std::string_view("000"))) == "0");
+    CHECK(text(BigUnsigned(std::string_view("  \t0042x7"))) == "42");
+    CHECK(BigUnsigned(std::string_view("00123")).length() == 3);
+
+    // a view need not be terminated where the number ends
+    std::string digits = "98765432109876543210";
+    CHECK(text(BigUnsigned(std::string_view(digits).substr(0, 5))) == "98765");
+
+    TestRandom random(26);
+    for (int i = 0; i < 200; i++) {
+        std::string number = std::to_string(1 + random.below(9));
+        number += random.word(random.below(3000), "0123456789");
+        CHECK(text(BigUnsigned(std::string_view(number))) == number);
+
+        std::istringstream in("  000" + number + " 7");
+        BigUnsigned first, second;
+        in >> first >> second;
+        CHECK(in && text(first) == number && text(second) == "7");
+    }
+
+    std::istringstream zeros("000 x");
+    BigUnsigned zero, none;
+    zeros >> zero;
+    CHECK(zeros && text(zero) == "0");
+    zeros >> none;
+    CHECK(zeros.fail());
+
+    std::istringstream last("123");
+    BigUnsigned value;
+    last >> value;
+    CHECK(!last.fail() && last.eof() && text(value) == "123");
+}
+
+
+/** ***************************************************************************
+ * multi-operand addition against chained += and 64-bit sums
+ *
+ *****************************************************************************/
+static void test_add_all() {
+    TestRandom random(27);
+    for (int i = 0; i < 300; i++) {
+        size_t count = random.below(40);
+        std::vector<BigUnsigned> values;
+        uint64_t small = 0;
+        for (size_t k = 0; k < count; k++) {
+            uint64_t v = random.below(1000000000000u);
+            small += v;
+            values.push_back(BigUnsigned(std::string_view(std::to_string(v))));
+        }
+        std::vector<const BigUnsigned *> terms;
+        for (const BigUnsigned &v : values)
+            terms.push_back(&v);
+
+        BigUnsigned sum(12345);
+        BigUnsigned::add_all(sum, terms.data(), count);
+        CHECK(text(sum) == std::to_string(small));
+    }
+
+    // operands of different lengths, and sum as one of its own operands
+    BigUnsigned a(std::string_view(std::string(500, '9')));
+    BigUnsigned b(1);
+    BigUnsigned expected = a + b;
+    const BigUnsigned *pair[] = {&a, &b};
+    BigUnsigned::add_all(a, pair, 2);
+    CHECK(a == expected);
+    CHECK(text(a) == "1" + std::string(500, '0'));
+}
+
+
+
+/** ***************************************************************************
+ * comparisons and subtraction against 64-bit arithmetic, and borrows that
+ *  run the whole length of a number
+ *
+ *****************************************************************************/
+static void test_compare_subtract() {
+    TestRandom random(41);
+    for (int i = 0; i < 2000; i++) {
+        // small values and values with equal leading digits come up often
+        uint64_t x = i % 3 ? random.below(uint64_t(1) << 62) : random.below(1000);
+        uint64_t y = i % 5 ? random.below(uint64_t(1) << 62) : x - random.below(2);
+        BigUnsigned a(std::string_view(std::to_string(x)));
+        BigUnsigned b(std::string_view(std::to_string(y)));
+        CHECK((a == b) == (x == y));
+        CHECK((a != b) == (x != y));
+        CHECK((a < b) == (x < y));
+        CHECK((a <= b) == (x <= y));
+        CHECK((a > b) == (x > y));
+        CHECK((a >= b) == (x >= y));
+        if (x >= y) {
+            CHECK(text(a - b) == std::to_string(x - y));
+            a -= b;
+            CHECK(text(a) == std::to_string(x - y));
+        }
+        else {
+            CHECK_THROWS(a - b, std::underflow_error);
+        }
+    }
+
+    BigUnsigned power(std::string_view("1" + std::string(500, '0')));
+    BigUnsigned nines(std::string_view(std::string(500, '9')));
+    CHECK(text(power - BigUnsigned(1)) == std::string(500, '9'));
+    CHECK(power - BigUnsigned(1) == nines);
+    CHECK(text(power - nines) == "1");
+    CHECK(text(power - power) == "0");
+    CHECK(nines < power && power > nines && !(power < nines));
+}
+
+
+
+/** ***************************************************************************
+ * weighted sums against 64-bit arithmetic, and products by a factor
+ *  against the full product
+ *
+ *****************************************************************************/
+static void test_multiply_add_all() {
+    TestRandom random(44);
+    for (int i = 0; i < 300; i++) {
+        size_t count = random.below(20);
+        std::vector<BigUnsigned> values;
+        std::vector<unsigned> factors;
+        uint64_t small = 0;
+        for (size_t k = 0; k < count; k++) {
+            uint64_t v = random.below(1000000000);
+            unsigned f = unsigned(i % 4 ? random.below(1 << 16) : random.below(2));
+            small += v * f;
+            values.push_back(BigUnsigned(std::string_view(std::to_string(v))));
+            factors.push_back(f);
+        }
+        std::vector<const BigUnsigned *> terms;
+        for (const BigUnsigned &v : values)
+            terms.push_back(&v);
+
+        BigUnsigned sum(777);
+        BigUnsigned::multiply_add_all(sum, terms.data(), factors.data(), count);
+        CHECK(text(sum) == std::to_string(small));
+    }
+
+    // sum as its own operand, with factors that need carries of many digits
+    BigUnsigned a(std::string_view(std::string(300, '9')));
+    BigUnsigned b(std::string_view("123456789"));
+    BigUnsigned expected = a * BigUnsigned(4294967295u) + b * BigUnsigned(3);
+    const BigUnsigned *pair[] = {&a, &b};
+    const unsigned factors[] = {4294967295u, 3};
+    BigUnsigned::multiply_add_all(a, pair, factors, 2);
+    CHECK(a == expected);
+
+    for (unsigned factor : {0u, 1u, 9u, 10u, 65536u, 4294967295u}) {
+        BigUnsigned c(std::string_view("98765432109876543210987654321"));
+        CHECK(c * factor == c * BigUnsigned(factor));
+    }
+    CHECK(text(BigUnsigned(0) * 5u) == "0");
+}
+
+
+
+/** ***************************************************************************
+ * division and remainder by a machine number against 64-bit arithmetic,
+ *  and a long quotient checked by multiplying back
+ *
+ *****************************************************************************/
+static void test_divide() {
+    TestRandom random(48);
+    for (int i = 0; i < 2000; i++) {
+        uint64_t x = i % 2 ? random.below(uint64_t(1) << 63) : random.below(100000);
+        unsigned d = unsigned(i % 3 ? 1 + random.below(4294967295u) : 1 + random.below(12));
+        BigUnsigned a(std::string_view(std::to_string(x)));
+        CHECK(text(a / d) == std::to_string(x / d));
+        CHECK(a % d == x % d);
+    }
+
+    BigUnsigned big(std::string_view("1" + std::string(400, '7') + "3"));
+    for (unsigned d : {1u, 7u, 10u, 999983u, 4294967295u}) {
+        BigUnsigned quotient = big / d;
+        unsigned remainder = big % d;
+        CHECK(remainder < d);
+        CHECK(quotient * d + BigUnsigned(remainder) == big);
+    }
+    CHECK(text(BigUnsigned(5) / 7u) == "0");
+    CHECK_THROWS(big / 0u, std::domain_error);
+    CHECK_THROWS(big % 0u, std::domain_error);
+}
+
+
+
+/** ***************************************************************************
+ * draws below a bound stay below it and hit every value about equally
+ *  often
+ *
+ *****************************************************************************/
+static void test_uniform_below() {
+    TestRandom random(40);
+    auto generator = [&random]() { return random.next(); };
+    for (unsigned bound : {1u, 7u, 10u, 99u, 256u}) {
+        std::vector<unsigned> seen(bound, 0);
+        const unsigned draws = 200 * bound;
+        for (unsigned i = 0; i < draws; i++) {
+            BigUnsigned r = BigUnsigned::uniform_below(BigUnsigned(bound), generator);
+            CHECK(r < BigUnsigned(bound));
+            seen[std::stoul(text(r)) % bound]++;
+        }
+        // within seven standard deviations of the mean of 200
+        for (unsigned count : seen)
+            CHECK(count > 200 - 7 * 14 && count < 200 + 7 * 14);
+    }
+
+    BigUnsigned huge(std::string_view("3" + std::string(80, '0') + "7"));
+    for (int i = 0; i < 100; i++)
+        CHECK(BigUnsigned::uniform_below(huge, generator) < huge);
+}
+
+
+int main() {
+    test_parsing();
+    test_add_all();
+    test_compare_subtract();
+    test_multiply_add_all();
+    test_divide();
+    test_uniform_below();
+    return report("BigUnsignedTest");
+}
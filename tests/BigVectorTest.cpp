@@ -0,0 +1,61 @@
+/** ***************************************************************************
+ * @file:   BigVectorTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of BigVector against sums of BigUnsigned
+ *
+ *****************************************************************************/
+
+#include "BigVector.hpp"
+#include "TestSupport.hpp"
+#include <stdexcept>
+#include <vector>
+
+
+/** ***************************************************************************
+ * repeated gather sums over random successor lists, for fanouts that take
+ *  the vector kernel and fanouts that take the scalar one
+ *
+ *****************************************************************************/
+static void test_gather_sum() {
+    TestRandom random(28);
+    for (size_t fanout : {size_t(1), size_t(4), size_t(7), size_t(120)}) {
+        for (size_t entries : {size_t(1), size_t(9), size_t(37)}) {
+            std::vector<int> successors(fanout * entries);
+            for (int &s : successors)
+                s = int(random.below(entries));
+
+            BigVector current(entries), previous;
+            std::vector<BigUnsigned> expected(entries);
+            for (size_t i = 0; i < entries; i++) {
+                unsigned value = unsigned(random.below(100000));
+                current.assign(i, value);
+                expected[i] = BigUnsigned(value);
+            }
+
+            for (int step = 0; step < 30; step++) {
+                previous = BigVector(entries);
+                previous.swap(current);
+                current.gather_sum(previous, successors.data(), fanout);
+
+                std::vector<BigUnsigned> next(entries);
+                for (size_t i = 0; i < entries; i++)
+                    for (size_t j = 0; j < fanout; j++)
+                        next[i] += expected[successors[j * entries + i]];
+                expected.swap(next);
+            }
+            for (size_t i = 0; i < entries; i++)
+                CHECK(current.at(i) == expected[i]);
+        }
+    }
+
+    BigVector self(3);
+    int successors[] = {0, 1, 2};
+    CHECK_THROWS(self.gather_sum(self, successors, 1), std::invalid_argument);
+}
+
+
+int main() {
+    test_gather_sum();
+    return report("BigVectorTest");
+}
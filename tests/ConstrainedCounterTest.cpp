@@ -0,0 +1,127 @@
+/** ***************************************************************************
+ * @file:   ConstrainedCounterTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of ConstrainedCounter against the accepted strings with a
+ *  given prefix and suffix, counted by brute force
+ *
+ *****************************************************************************/
+
+#include "ConstrainedCounter.hpp"
+#include "TestSupport.hpp"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+/** ***************************************************************************
+ * every pair of a few prefixes and suffixes, overlapping ones and ones
+ *  with symbols outside Σ included, with few tables kept so that they
+ *  are dropped and built again
+ *
+ *****************************************************************************/
+static void test_against_brute_force() {
+    const std::vector<std::string> affixes{
+        "", "a", "ab", "dd", "abcd", "aaaa", "cbad", "abcdab", "bx", "dabc"};
+    const size_t count = affixes.size();
+
+    // expected[(n * count + i) * count + j] for prefix i and suffix j
+    std::vector<uint64_t> expected((8 + 1) * count * count, 0);
+    for (int n = 0; n <= 8; n++) {
+        for (const std::string &w : all_strings(n)) {
+            if (!in_language(w))
+                continue;
+            for (size_t i = 0; i < count; i++) {
+                const std::string &prefix = affixes[i];
+                if (w.compare(0, prefix.size(), prefix) != 0)
+                    continue;
+                for (size_t j = 0; j < count; j++) {
+                    const std::string &suffix = affixes[j];
+                    if (w.size() >= suffix.size()
+                        && w.compare(w.size() - suffix.size(), suffix.size(), suffix) == 0)
+                        expected[(n * count + i) * count + j]++;
+                }
+            }
+        }
+    }
+
+    DFA<char> dfa;
+    for (int maxTables : {1, 3, ConstrainedCounter<char>::MAX_TABLES}) {
+        ConstrainedCounter<char> counter(dfa, maxTables);
+        for (int n = 0; n <= 8; n++) {
+            for (size_t i = 0; i < count; i++) {
+                for (size_t j = 0; j < count; j++) {
+                    CHECK(text(counter.count(n, affixes[i], affixes[j]))
+                          == std::to_string(expected[(n * count + i) * count + j]));
+                    CHECK(counter.tables() <= maxTables);
+                }
+            }
+        }
+    }
+}
+
+
+/** ***************************************************************************
+ * the tables kept, long lengths and the arguments refused
+ *
+ *****************************************************************************/
+static void test_tables() {
+    DFA<char> dfa;
+    ConstrainedCounter<char> counter(dfa);
+    CHECK(counter.tables() == 0);
+
+    // no constraint is the plain count
+    CHECK(text(counter.count(9, "", "")) == std::to_string(brute_count(9)));
+    CHECK(counter.tables() == 1);
+    CHECK(counter.count(300, "", "") == dfa.num_strings_accepted(300));
+    CHECK(counter.tables() == 1);
+
+    // no accepted string ends in a suffix outside L, and a suffix cuts
+    // the count down
+    CHECK(text(counter.count(40, "abcd", "aaaaaa")) == "0");
+    BigUnsigned both = counter.count(40, "abcd", "dcba");
+    CHECK(both < counter.count(40, "abcd", ""));
+    CHECK(counter.tables() == 3);
+    counter.forget();
+    CHECK(counter.tables() == 0);
+    CHECK(counter.count(40, "abcd", "dcba") == both);
+
+    CHECK_THROWS(counter.count(-1, "", ""), std::invalid_argument);
+    CHECK_THROWS(ConstrainedCounter<char>(dfa, 0), std::invalid_argument);
+}
+
+
+/** ***************************************************************************
+ * suffixes asked for again, after their table was dropped and after more
+ * than MAX_SUFFIXES were remembered
+ *
+ *****************************************************************************/
+static void test_repeated_suffixes() {
+    DFA<char> dfa;
+    ConstrainedCounter<char> fresh(dfa);
+    ConstrainedCounter<char> one(dfa, 1);
+    const std::vector<std::string> suffixes{"dcba", "abcd", "dcba", "", "abcd", "dcba"};
+    for (const std::string &suffix : suffixes) {
+        CHECK(one.count(30, "ab", suffix) == fresh.count(30, "ab", suffix));
+        CHECK(one.tables() == 1);
+    }
+
+    // every string of length 6 is a suffix, more than are remembered
+    ConstrainedCounter<char> many(dfa);
+    std::vector<std::string> words = all_strings(6);
+    words.push_back("abcdab");
+    CHECK(words.size() > ConstrainedCounter<char>::MAX_SUFFIXES);
+    BigUnsigned total;
+    for (const std::string &suffix : words)
+        total += many.count(10, "", suffix);
+    CHECK(total == many.count(10, "", "") + many.count(10, "", "abcdab"));
+    CHECK(many.count(10, "", "dcbadc") == fresh.count(10, "", "dcbadc"));
+}
+
+
+int main() {
+    test_against_brute_force();
+    test_tables();
+    test_repeated_suffixes();
+    return report("ConstrainedCounterTest");
+}
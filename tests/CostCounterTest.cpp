@@ -0,0 +1,81 @@
+/** ***************************************************************************
+ * @file:   CostCounterTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of CostCounter against the accepted strings summed by cost
+ *  by brute force
+ *
+ *****************************************************************************/
+
+#include "CostCounter.hpp"
+#include "TestSupport.hpp"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+/** ***************************************************************************
+ * counts of every cost up to 8 for several cost assignments, exact and
+ *  cumulative, in both number types
+ *
+ *****************************************************************************/
+static void test_small() {
+    DFA<char> dfa;
+    const unsigned top = 8;
+    const std::vector<std::vector<unsigned>> assignments{
+        {1, 1, 1, 1}, {1, 2, 3, 1}, {2, 2, 2, 2}, {1, 1, 5, 2}};
+    for (const std::vector<unsigned> &costs : assignments) {
+        CostCounter counter(dfa, costs);
+        CHECK(counter.letters() == 4);
+
+        // every letter costs at least 1, so no string longer than top fits
+        std::vector<uint64_t> exact(top + 1, 0);
+        for (int n = 0; n <= int(top); n++) {
+            for (const std::string &w : all_strings(n)) {
+                unsigned cost = 0;
+                for (char symbol : w)
+                    cost += costs[symbol - 'a'];
+                if (cost <= top && in_language(w))
+                    exact[cost]++;
+            }
+        }
+
+        uint64_t cumulative = 0;
+        for (unsigned budget = 0; budget <= top; budget++) {
+            cumulative += exact[budget];
+            CHECK(text(counter.exactly(budget)) == std::to_string(exact[budget]));
+            CHECK(text(counter.at_most(budget)) == std::to_string(cumulative));
+            CHECK(counter.exactly_mod(budget, 5) == exact[budget] % 5);
+            CHECK(counter.at_most_mod(budget, uint64_t(1) << 63) == cumulative);
+        }
+    }
+}
+
+
+/** ***************************************************************************
+ * unit costs give the counts by length, large budgets agree across the
+ *  number types, and the arguments refused
+ *
+ *****************************************************************************/
+static void test_long() {
+    DFA<char> dfa;
+    CostCounter unit(dfa, {1, 1, 1, 1});
+    CHECK(unit.exactly(120) == DFA<char>().num_strings_accepted(120));
+
+    CostCounter weighted(dfa, {3, 1, 4, 1});
+    const uint64_t prime = 1000000007;
+    CHECK(weighted.exactly(150) % unsigned(prime) == weighted.exactly_mod(150, prime));
+    CHECK(weighted.at_most(150) % unsigned(prime) == weighted.at_most_mod(150, prime));
+    CHECK(weighted.exactly(150) < weighted.at_most(150));
+
+    CHECK_THROWS(CostCounter(dfa, {1, 1, 1}), std::invalid_argument);
+    CHECK_THROWS(CostCounter(dfa, {1, 0, 1, 1}), std::invalid_argument);
+    CHECK_THROWS(weighted.exactly_mod(3, 0), std::invalid_argument);
+}
+
+
+int main() {
+    test_small();
+    test_long();
+    return report("CostCounterTest");
+}
@@ -0,0 +1,94 @@
+/** ***************************************************************************
+ * @file:   CyclicCounterTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of CyclicCounter against circular words and necklaces
+ *  counted by brute force
+ *
+ *****************************************************************************/
+
+#include "CyclicCounter.hpp"
+#include "TestSupport.hpp"
+#include <stdexcept>
+#include <string>
+
+
+/** ***************************************************************************
+ * @return true if every window of 6 symbols of w, read around the circle,
+ *  holds every letter
+ *
+ *****************************************************************************/
+static bool circular(const std::string &w) {
+    for (size_t i = 0; i < w.size(); i++) {
+        unsigned seen = 0;
+        for (size_t j = 0; j < 6; j++)
+            seen |= 1u << (w[(i + j) % w.size()] - 'a');
+        if (seen != 15)
+            return false;
+    }
+    return true;
+}
+
+
+/** ***************************************************************************
+ * circular words and necklaces for n <= 9, a necklace being counted once
+ *  by its smallest rotation
+ *
+ *****************************************************************************/
+static void test_small() {
+    DFA<char> dfa;
+    CyclicCounter counter(dfa);
+    CHECK(counter.cycle_states() == 840);
+    CHECK(counter.orbits() == 35);
+    for (int n = 1; n <= 9; n++) {
+        uint64_t words = 0, necklaces = 0;
+        for (const std::string &w : all_strings(n)) {
+            if (!circular(w))
+                continue;
+            words++;
+            bool smallest = true;
+            for (int k = 1; k < n && smallest; k++)
+                smallest = w <= w.substr(k) + w.substr(0, k);
+            necklaces += smallest;
+        }
+        CHECK(text(counter.circular_words<BigUnsigned>(n)) == std::to_string(words));
+        CHECK(counter.circular_words<DFA<char>::FixedCount>(n).to_string()
+              == std::to_string(words));
+        CHECK(text(counter.necklaces(n)) == std::to_string(necklaces));
+    }
+}
+
+
+/** ***************************************************************************
+ * longer lengths: the number types agree, every necklace has at most n
+ *  rotations, and the lengths refused
+ *
+ *****************************************************************************/
+static void test_long() {
+    DFA<char> dfa;
+    CyclicCounter counter(dfa);
+    for (int n : {24, 31}) {
+        BigUnsigned words = counter.circular_words<BigUnsigned>(n);
+        CHECK(counter.circular_words<DFA<char>::FixedCount>(n).to_string() == text(words));
+        BigUnsigned necklaces = counter.necklaces(n);
+        CHECK(necklaces * unsigned(n) >= words);
+        CHECK(necklaces <= words);
+
+        // for a prime length every necklace but the constant ones, none
+        // of which is circular, has exactly n rotations
+        if (n == 31)
+            CHECK(necklaces * unsigned(n) == words);
+    }
+
+    CHECK_THROWS(counter.circular_words<BigUnsigned>(0), std::invalid_argument);
+    CHECK_THROWS(counter.necklaces(0), std::invalid_argument);
+    CHECK_THROWS(counter.circular_words<DFA<char>::FixedCount>(DFA<char>::FIXED_MAX_N + 1),
+                 std::out_of_range);
+}
+
+
+int main() {
+    test_small();
+    test_long();
+    return report("CyclicCounterTest");
+}
@@ -0,0 +1,137 @@
+/** ***************************************************************************
+ * @file:   DFATest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of the DFA and its counts against brute force
+ *
+ *****************************************************************************/
+
+#include "DFA.hpp"
+#include "BigArena.hpp"
+#include "TestSupport.hpp"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+/** ***************************************************************************
+ * the counting DP against brute-force counts for small n
+ *
+ *****************************************************************************/
+static void test_counts() {
+    for (int n = 0; n <= 9; n++) {
+        // num_strings_accepted continues from the counts of earlier calls,
+        // so every length gets a fresh DFA
+        DFA<char> dfa;
+        CHECK(text(dfa.num_strings_accepted(n)) == std::to_string(brute_count(n)));
+    }
+
+    // continuing runs add up their lengths
+    DFA<char> dfa;
+    dfa.num_strings_accepted(4);
+    CHECK(text(dfa.num_strings_accepted(5)) == std::to_string(brute_count(9)));
+}
+
+
+/** ***************************************************************************
+ * counting runs with an arena attached: the BigUnsigned run takes its
+ *  storage from the arena, results outlive a reset, and the BigVector run
+ *  leaves the arena untouched
+ *
+ *****************************************************************************/
+static void test_arena() {
+    BigArena arena;
+    DFA<char> dfa;
+    dfa.set_arena(&arena);
+
+    BigUnsigned counted = dfa.num_strings_accepted_as<BigUnsigned>(60);
+    CHECK(arena.allocations() > 0);
+    CHECK(arena.bytes_allocated() > 0);
+    arena.reset();
+    CHECK(counted == DFA<char>().num_strings_accepted(60));
+
+    BigArena unused;
+    DFA<char> vectorRun;
+    vectorRun.set_arena(&unused);
+    vectorRun.num_strings_accepted(60);
+    CHECK(unused.allocations() == 0);
+
+    // values made inside a scope come from its arena, and outside from the heap
+    BigArena scoped;
+    {
+        BigArena::Scope scope(&scoped);
+        CHECK(BigArena::current() == &scoped);
+        BigUnsigned inside(std::string_view("123456789"));
+        CHECK(text(inside) == "123456789");
+    }
+    CHECK(BigArena::current() == nullptr);
+    CHECK(scoped.allocations() == 1);
+}
+
+
+/** ***************************************************************************
+ * fixed-width counts agree with BigUnsigned up to their bound and throw
+ *  past it
+ *
+ *****************************************************************************/
+static void test_fixed_counts() {
+    typedef DFA<char>::FixedCount FixedCount;
+    DFA<char> dfa;
+    for (int n : {0, 1, 5, 6, 7, 50, 299, DFA<char>::FIXED_MAX_N}) {
+        CHECK(text(dfa.num_strings_accepted_as<FixedCount>(n))
+              == text(dfa.num_strings_accepted_as<BigUnsigned>(n)));
+    }
+    CHECK_THROWS(dfa.num_strings_accepted_as<FixedCount>(DFA<char>::FIXED_MAX_N + 1),
+                 std::out_of_range);
+}
+
+
+
+/** ***************************************************************************
+ * count_vector against the strings accepted from every state, counted by
+ *  running every string from that state; views of earlier lengths stay
+ *  valid while longer ones are added
+ *
+ *****************************************************************************/
+static void test_count_vector() {
+    DFA<char> dfa;
+    const int *table = dfa.transition_table();
+    const int width = dfa.table_width();
+    std::vector<CountView> views;
+    for (int n = 0; n <= 4; n++) {
+        CountView view = dfa.count_vector(n);
+        CHECK(view.size() == DFA<char>::STATES);
+        CHECK(view.length() == n);
+        for (int q = 0; q < DFA<char>::STATES; q++) {
+            unsigned accepted = 0;
+            for (const std::string &w : all_strings(n)) {
+                int state = q;
+                for (char symbol : w)
+                    state = table[state * width + dfa.symbol_class(symbol)];
+                accepted += state != DFA<char>::DEAD;
+            }
+            CHECK(text(view[q]) == std::to_string(accepted));
+        }
+        views.push_back(view);
+    }
+
+    CountView longer = dfa.count_vector(60);
+    CHECK(longer[DFA<char>::START] == DFA<char>().num_strings_accepted(60));
+    CHECK(text(longer[DFA<char>::DEAD]) == "0");
+    for (int n = 0; n <= 4; n++)
+        CHECK(text(views[n][DFA<char>::START]) == std::to_string(brute_count(n)));
+
+    // asking for a shorter length again after a release starts over
+    dfa.release_counts();
+    CHECK(dfa.count_vector(9)[DFA<char>::START] == DFA<char>().num_strings_accepted(9));
+    CHECK_THROWS(dfa.count_vector(-1), std::invalid_argument);
+}
+
+
+int main() {
+    test_counts();
+    test_arena();
+    test_fixed_counts();
+    test_count_vector();
+    return report("DFATest");
+}
@@ -0,0 +1,99 @@
+/** ***************************************************************************
+ * @file:   EnumeratorTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of Enumerator against the accepted strings listed in
+ *  lexicographic order by brute force
+ *
+ *****************************************************************************/
+
+#include "Enumerator.hpp"
+#include "TestSupport.hpp"
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+/** ***************************************************************************
+ * @return the accepted strings of length n in lexicographic order
+ *
+ *****************************************************************************/
+static std::vector<std::string> accepted(int n) {
+    std::vector<std::string> result;
+    for (const std::string &w : all_strings(n))
+        if (in_language(w))
+            result.push_back(w);
+    return result;
+}
+
+
+/** ***************************************************************************
+ * the sequential search lists exactly the accepted strings, in order
+ *
+ *****************************************************************************/
+static void test_sequential() {
+    DFA<char> dfa;
+    Enumerator<char> enumerator(dfa);
+    for (int n = 0; n <= 8; n++) {
+        std::vector<std::string> listed;
+        uint64_t count = enumerator.enumerate(n, [&](std::string_view w) {
+            listed.emplace_back(w);
+        });
+        CHECK(listed == accepted(n));
+        CHECK(count == listed.size());
+    }
+    CHECK_THROWS(enumerator.enumerate(-1, [](std::string_view) { }),
+                 std::invalid_argument);
+}
+
+
+/** ***************************************************************************
+ * the parallel search lists the same strings, in some order, for several
+ *  numbers of threads
+ *
+ *****************************************************************************/
+static void test_parallel() {
+    DFA<char> dfa;
+    Enumerator<char> enumerator(dfa);
+    for (unsigned threads : {1u, 3u, 8u}) {
+        for (int n : {0, 1, 6, 8}) {
+            std::mutex lock;
+            std::vector<std::string> listed;
+            uint64_t count = enumerator.enumerate_parallel(n, [&](std::string_view w) {
+                std::lock_guard<std::mutex> hold(lock);
+                listed.emplace_back(w);
+            }, threads);
+            std::sort(listed.begin(), listed.end());
+            CHECK(listed == accepted(n));
+            CHECK(count == listed.size());
+        }
+    }
+}
+
+
+/** ***************************************************************************
+ * lengths that go down and then up again reuse the table built for the
+ *  longest one
+ *
+ *****************************************************************************/
+static void test_lengths() {
+    DFA<char> dfa;
+    Enumerator<char> enumerator(dfa);
+    auto ignore = [](std::string_view) { };
+    CHECK(enumerator.enumerate(8, ignore) == brute_count(8));
+    CHECK(enumerator.enumerate(3, ignore) == 64);
+    CHECK(enumerator.enumerate(6, ignore) == 1560);
+    CHECK(enumerator.enumerate_parallel(2, ignore, 2) == 16);
+    CHECK(enumerator.enumerate_parallel(7, ignore, 2) == brute_count(7));
+    CHECK(enumerator.enumerate(9, ignore) == brute_count(9));
+}
+
+
+int main() {
+    test_sequential();
+    test_parallel();
+    test_lengths();
+    return report("EnumeratorTest");
+}
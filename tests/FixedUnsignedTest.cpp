@@ -0,0 +1,81 @@
+/** ***************************************************************************
+ * @file:   FixedUnsignedTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of FixedUnsigned against BigUnsigned
+ *
+ *****************************************************************************/
+
+#include "FixedUnsigned.hpp"
+#include "BigUnsigned.hpp"
+#include "TestSupport.hpp"
+#include <sstream>
+#include <string>
+
+typedef FixedUnsigned<640> Fixed;
+
+
+/** ***************************************************************************
+ * @return a random decimal number of up to the given number of digits
+ *
+ *****************************************************************************/
+static std::string random_number(TestRandom &random, size_t digits) {
+    return std::to_string(random.below(10))
+           + random.word(random.below(digits), "0123456789");
+}
+
+
+/** ***************************************************************************
+ * arithmetic, comparison and text against BigUnsigned, below the width
+ *
+ *****************************************************************************/
+static void test_arithmetic() {
+    TestRandom random(30);
+    for (int i = 0; i < 300; i++) {
+        std::string a = random_number(random, 90);
+        std::string b = random_number(random, 90);
+        Fixed fa(a), fb(b);
+        BigUnsigned ba{std::string_view(a)}, bb{std::string_view(b)};
+
+        CHECK(fa.to_string() == text(ba));
+        CHECK(text(fa + fb) == text(ba + bb));
+        CHECK(text(fa * fb) == text(ba * bb));
+        CHECK((fa < fb) == (ba < bb));
+        CHECK((fa == fb) == (ba == bb));
+        if (!(fa < fb))
+            CHECK(text(fa - fb) == text(ba - bb));
+        CHECK(fa.length() == ba.length());
+    }
+
+    std::istringstream in(" 00123 x");
+    Fixed read, none;
+    in >> read;
+    CHECK(in && read.to_string() == "123");
+    in >> none;
+    CHECK(in.fail());
+}
+
+
+/** ***************************************************************************
+ * arithmetic wraps around modulo 2^DIGITS, whole limbs
+ *
+ *****************************************************************************/
+static void test_wrap_around() {
+    CHECK(FixedUnsigned<64>::DIGITS == 64);
+    CHECK(FixedUnsigned<65>::DIGITS == 128);
+    CHECK(Fixed::DIGITS == 640);
+    CHECK(fixed_digits<Fixed>::value == 640);
+    CHECK(fixed_digits<BigUnsigned>::value == 0);
+
+    // Bits = 1 still holds a whole limb
+    FixedUnsigned<1> small = FixedUnsigned<1>(0) - FixedUnsigned<1>(1);
+    CHECK(small.to_string() == "18446744073709551615");
+    CHECK((small + FixedUnsigned<1>(1)).to_string() == "0");
+}
+
+
+int main() {
+    test_arithmetic();
+    test_wrap_around();
+    return report("FixedUnsignedTest");
+}
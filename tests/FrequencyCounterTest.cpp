@@ -0,0 +1,88 @@
+/** ***************************************************************************
+ * @file:   FrequencyCounterTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of FrequencyCounter against the accepted strings split by
+ *  brute force by the occurrences of a letter
+ *
+ *****************************************************************************/
+
+#include "FrequencyCounter.hpp"
+#include "TestSupport.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+/** ***************************************************************************
+ * every length up to 8 and every letter, in all three number types
+ *
+ *****************************************************************************/
+static void test_small() {
+    DFA<char> dfa;
+    FrequencyCounter<char> counter(dfa);
+    for (int n = 0; n <= 8; n++) {
+        for (char x : std::string("abcd")) {
+            std::vector<uint64_t> expected(n + 1, 0);
+            for (const std::string &w : all_strings(n))
+                if (in_language(w))
+                    expected[std::count(w.begin(), w.end(), x)]++;
+
+            std::vector<BigUnsigned> big = counter.distribution<BigUnsigned>(n, x);
+            std::vector<DFA<char>::FixedCount> fixed =
+                counter.distribution<DFA<char>::FixedCount>(n, x);
+            std::vector<uint64_t> wide = counter.distribution_mod(n, x, uint64_t(1) << 63);
+            std::vector<uint64_t> seven = counter.distribution_mod(n, x, 7);
+            CHECK(big.size() == size_t(n + 1) && fixed.size() == big.size());
+            for (int j = 0; j <= n && big.size() == size_t(n + 1); j++) {
+                CHECK(text(big[j]) == std::to_string(expected[j]));
+                CHECK(fixed[j].to_string() == std::to_string(expected[j]));
+                CHECK(wide[j] == expected[j]);
+                CHECK(seven[j] == expected[j] % 7);
+            }
+        }
+    }
+}
+
+
+/** ***************************************************************************
+ * longer strings: the distribution adds up to the count, the number types
+ *  agree, and the arguments that are refused
+ *
+ *****************************************************************************/
+static void test_long() {
+    DFA<char> dfa;
+    FrequencyCounter<char> counter(dfa);
+    const int n = 60;
+    std::vector<BigUnsigned> big = counter.distribution<BigUnsigned>(n, 'c');
+    std::vector<DFA<char>::FixedCount> fixed =
+        counter.distribution<DFA<char>::FixedCount>(n, 'c');
+    std::vector<uint64_t> residues = counter.distribution_mod(n, 'c', 1000000007);
+    BigUnsigned total;
+    for (int j = 0; j <= n; j++) {
+        total += big[j];
+        CHECK(fixed[j].to_string() == text(big[j]));
+        CHECK(residues[j] == big[j] % 1000000007u);
+    }
+    CHECK(total == DFA<char>().num_strings_accepted(n));
+
+    // a letter must occur at least once in every window of 6
+    for (int j = 0; j < n / 6; j++)
+        CHECK(text(big[j]) == "0");
+
+    CHECK_THROWS(counter.distribution<BigUnsigned>(-1, 'a'), std::invalid_argument);
+    CHECK_THROWS(counter.distribution<BigUnsigned>(3, 'x'), std::invalid_argument);
+    CHECK_THROWS(counter.distribution_mod(3, 'a', 0), std::invalid_argument);
+    CHECK_THROWS(counter.distribution_mod(3, 'a', (uint64_t(1) << 63) + 1),
+                 std::invalid_argument);
+    CHECK_THROWS(counter.distribution<DFA<char>::FixedCount>(DFA<char>::FIXED_MAX_N + 1, 'a'),
+                 std::out_of_range);
+}
+
+
+int main() {
+    test_small();
+    test_long();
+    return report("FrequencyCounterTest");
+}
@@ -0,0 +1,101 @@
+/** ***************************************************************************
+ * @file:   HammingNeighborhoodTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of HammingNeighborhood against the strings within
+ *  distance d of L found by brute force
+ *
+ *****************************************************************************/
+
+#include "HammingNeighborhood.hpp"
+#include "TestSupport.hpp"
+#include <stdexcept>
+#include <string>
+
+
+/** ***************************************************************************
+ * @return true if changing at most one symbol of w gives a string in L
+ *
+ *****************************************************************************/
+static bool within_one(std::string w) {
+    if (in_language(w))
+        return true;
+    for (char &symbol : w) {
+        const char kept = symbol;
+        for (char letter : std::string("abcd")) {
+            symbol = letter;
+            if (in_language(w))
+                return true;
+        }
+        symbol = kept;
+    }
+    return false;
+}
+
+
+/** ***************************************************************************
+ * distance 0 is L itself
+ *
+ *****************************************************************************/
+static void test_distance_zero() {
+    DFA<char> dfa;
+    HammingNeighborhood<char> same(dfa, 0);
+    CHECK(same.distance() == 0);
+    CHECK(same.automaton().states() == 328);
+    for (int n = 0; n <= 7; n++) {
+        CHECK(text(same.count(n)) == std::to_string(brute_count(n)));
+        for (const std::string &w : all_strings(n, "abcx"))
+            CHECK(same.within(w) == in_language(w));
+    }
+}
+
+
+/** ***************************************************************************
+ * distance 1 against changing every symbol in turn, for strings with and
+ *  without symbols outside Σ
+ *
+ *****************************************************************************/
+static void test_distance_one() {
+    DFA<char> dfa;
+    HammingNeighborhood<char> near(dfa, 1);
+    CHECK(near.distance() == 1);
+    CHECK(near.explored() >= near.automaton().states());
+    for (int n = 0; n <= 7; n++) {
+        uint64_t count = 0;
+        for (const std::string &w : all_strings(n)) {
+            bool expected = within_one(w);
+            count += expected;
+            CHECK(near.within(w) == expected);
+        }
+        CHECK(text(near.count(n)) == std::to_string(count));
+        if (n <= 6)
+            for (const std::string &w : all_strings(n, "abcx"))
+                CHECK(near.within(w) == within_one(w));
+    }
+    CHECK(near.within("aaaaaabcd") == false);
+    CHECK(near.within("xbcdabcdabcdx") == false);
+    CHECK(near.within("xbcdabcdabcd") == true);
+}
+
+
+/** ***************************************************************************
+ * the limits on the distance and on the number of states
+ *
+ *****************************************************************************/
+static void test_limits() {
+    DFA<char> dfa;
+    CHECK_THROWS(HammingNeighborhood<char>(dfa, -1), std::invalid_argument);
+    CHECK_THROWS(HammingNeighborhood<char>(dfa, HammingNeighborhood<char>::MAX_DISTANCE + 1),
+                 std::invalid_argument);
+    CHECK_THROWS(HammingNeighborhood<char>(dfa, 1, 100), std::length_error);
+    HammingNeighborhood<char> same(dfa, 0);
+    CHECK_THROWS(same.count(-1), std::invalid_argument);
+}
+
+
+int main() {
+    test_distance_zero();
+    test_distance_one();
+    test_limits();
+    return report("HammingNeighborhoodTest");
+}
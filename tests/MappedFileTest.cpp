@@ -0,0 +1,134 @@
+/** ***************************************************************************
+ * @file:   MappedFileTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of MappedFile and of scanning files by path
+ *
+ *****************************************************************************/
+
+#include "MappedFile.hpp"
+#include "ParallelMatcher.hpp"
+#include "StreamMatcher.hpp"
+#include "TestSupport.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <fcntl.h>
+
+
+/** ***************************************************************************
+ * @return the name of a fresh file holding the given contents
+ *
+ *****************************************************************************/
+static std::string temporary_file(const std::string &contents) {
+    char name[] = "/tmp/MappedFileTestXXXXXX";
+    int fd = mkstemp(name);
+    CHECK(fd >= 0);
+    CHECK(write(fd, contents.data(), contents.size()) == ssize_t(contents.size()));
+    close(fd);
+    return name;
+}
+
+
+/** ***************************************************************************
+ * regular files are mapped whole; everything else is refused
+ *
+ *****************************************************************************/
+static void test_mapping() {
+    std::string contents = "abcdabcdxyz";
+    std::string path = temporary_file(contents);
+    {
+        MappedFile file(path);
+        CHECK(file.size() == contents.size());
+        CHECK(std::string(reinterpret_cast<const char *>(file.data()),
+                          file.size()) == contents);
+        CHECK(MappedFile::mappable(path));
+    }
+    std::remove(path.c_str());
+
+    std::string empty = temporary_file("");
+    {
+        MappedFile file(empty);
+        CHECK(file.size() == 0 && file.data() == nullptr);
+        CHECK(!MappedFile::mappable(empty));
+    }
+    std::remove(empty.c_str());
+
+    CHECK_THROWS(MappedFile("/tmp"), std::runtime_error);
+    CHECK_THROWS(MappedFile("/dev/null"), std::runtime_error);
+    CHECK_THROWS(MappedFile("/nonexistent/file"), std::runtime_error);
+    CHECK(!MappedFile::mappable("/proc/self/status"));
+    CHECK(!MappedFile::mappable("/dev/null"));
+}
+
+
+/** ***************************************************************************
+ * both matchers scan regular files, /proc files, devices and pipes by path
+ *
+ *****************************************************************************/
+static void test_scanning() {
+    DFA<char> dfa;
+    StreamMatcher<char> stream(dfa);
+    ParallelMatcher<char> parallel(dfa, 4, 16);
+
+    TestRandom random(32);
+    for (int i = 0; i < 20; i++) {
+        std::string w = random.word(random.below(400), "abcd");
+        if (i % 2 == 0) {
+            w.clear();
+            while (w.size() < 300)
+                w += "abcd";
+        }
+        std::string path = temporary_file(w);
+        for (MatchResult result : {stream.match_file(path), parallel.match_file(path)}) {
+            CHECK(result.accepted == in_language(w));
+            CHECK(result.offset == first_violation(w));
+        }
+        std::remove(path.c_str());
+    }
+
+    // /proc files report size 0 but are read in full: "Name:" is rejected at
+    // its first symbol, not accepted as an empty file
+    for (MatchResult result : {stream.match_file("/proc/self/status"),
+                               parallel.match_file("/proc/self/status")}) {
+        CHECK(!result.accepted && result.offset == 0);
+    }
+    for (MatchResult result : {stream.match_file("/dev/null"),
+                               parallel.match_file("/dev/null")}) {
+        CHECK(result.accepted && result.offset == 0);
+    }
+
+    // a named pipe is read as a stream
+    std::string fifo = "/tmp/MappedFileTestFifo" + std::to_string(getpid());
+    CHECK(mkfifo(fifo.c_str(), 0600) == 0);
+    std::thread writer([&]() {
+        std::ofstream out(fifo);
+        out << "abcdabcdabcdab";
+    });
+    MatchResult piped = parallel.match_file(fifo);
+    writer.join();
+    std::remove(fifo.c_str());
+    CHECK(piped.accepted && piped.offset == 14);
+
+    CHECK_THROWS(stream.match_file("/tmp"), std::runtime_error);
+    CHECK_THROWS(parallel.match_file("/nonexistent/file"), std::runtime_error);
+
+    // a wide-symbol file must hold whole symbols
+    DFA<char32_t> wide;
+    std::string odd = temporary_file(std::string("a\0\0\0b\0\0", 7));
+    CHECK_THROWS(StreamMatcher<char32_t>(wide).match_file(odd), std::runtime_error);
+    CHECK_THROWS(ParallelMatcher<char32_t>(wide).match_file(odd), std::runtime_error);
+    std::remove(odd.c_str());
+}
+
+
+int main() {
+    test_mapping();
+    test_scanning();
+    return report("MappedFileTest");
+}
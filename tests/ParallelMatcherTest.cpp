@@ -0,0 +1,128 @@
+/** ***************************************************************************
+ * @file:   ParallelMatcherTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of ParallelMatcher against the oracle for L
+ *
+ *****************************************************************************/
+
+#include "ParallelMatcher.hpp"
+#include "TestSupport.hpp"
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <sys/resource.h>
+#include <unistd.h>
+
+
+/** ***************************************************************************
+ * @return a string in L with one symbol changed at a random place, or
+ *  unchanged
+ *
+ *****************************************************************************/
+static std::string with_one_error(TestRandom &random, size_t length) {
+    std::string w;
+    while (w.size() < length)
+        w += random.below(2) ? "abcd" : "dcba";
+    w.resize(length);
+    if (length > 0 && random.below(3) != 0)
+        w[random.below(length)] = "abcdx"[random.below(5)];
+    return w;
+}
+
+
+/** ***************************************************************************
+ * chunked runs with several threads give the sequential outcome, for
+ *  violations anywhere, including at chunk borders
+ *
+ *****************************************************************************/
+static void test_chunks() {
+    DFA<char> dfa;
+    StreamMatcher<char> sequential(dfa);
+    TestRandom random(33);
+    for (unsigned threads : {1u, 2u, 3u, 8u}) {
+        ParallelMatcher<char> matcher(dfa, threads, 1);
+        for (int i = 0; i < 200; i++) {
+            std::string w = with_one_error(random, random.below(200));
+            MatchResult result = matcher.match(w.data(), w.size());
+            CHECK(result.accepted == in_language(w));
+            CHECK(result.offset == first_violation(w));
+            MatchResult expected = sequential.match(w.data(), w.size());
+            CHECK(result.state == expected.state);
+        }
+        for (const std::string &w : all_strings(6, "abcx")) {
+            MatchResult result = matcher.match(w.data(), w.size());
+            CHECK(result.accepted == in_language(w));
+            CHECK(result.offset == first_violation(w));
+        }
+    }
+
+    DFA<char32_t> wide;
+    ParallelMatcher<char32_t> wideMatcher(wide, 4, 1);
+    for (int i = 0; i < 100; i++) {
+        std::string w = with_one_error(random, random.below(100));
+        std::u32string u(w.begin(), w.end());
+        MatchResult result = wideMatcher.match(u.data(), u.size());
+        CHECK(result.accepted == in_language(w));
+        CHECK(result.offset == first_violation(w));
+    }
+}
+
+
+
+/** ***************************************************************************
+ * with too little address space left for the stack of another thread,
+ *  match maps every chunk on the calling thread and gives the same
+ *  outcome
+ *
+ *****************************************************************************/
+static void test_no_threads() {
+    DFA<char> dfa;
+    ParallelMatcher<char> matcher(dfa, 8, 1);
+    TestRandom random(133);
+    std::vector<std::string> words;
+    for (int i = 0; i < 50; i++)
+        words.push_back(with_one_error(random, 100 + random.below(100)));
+    std::vector<MatchResult> results;
+    results.reserve(words.size());
+
+    // what is mapped now and 4 MB more, less than a thread stack takes
+    long pages = 0;
+    std::ifstream("/proc/self/statm") >> pages;
+    rlimit saved;
+    getrlimit(RLIMIT_AS, &saved);
+    rlimit tight = saved;
+    tight.rlim_cur = rlim_t(pages) * sysconf(_SC_PAGESIZE) + (4 << 20);
+    bool limited = pages > 0 && setrlimit(RLIMIT_AS, &tight) == 0;
+
+    // glibc keeps the stacks of finished threads for reuse, so a few
+    // threads may still start; eight at once must not
+    std::vector<std::thread> probes;
+    probes.reserve(8);
+    try {
+        while (probes.size() < 8)
+            probes.emplace_back([] { });
+    }
+    catch (const std::system_error &) { }
+    const size_t started = probes.size();
+    for (std::thread &probe : probes)
+        probe.join();
+    for (const std::string &w : words)
+        results.push_back(matcher.match(w.data(), w.size()));
+    setrlimit(RLIMIT_AS, &saved);
+
+    CHECK(limited && started < 8);
+    for (size_t i = 0; i < words.size(); i++) {
+        CHECK(results[i].accepted == in_language(words[i]));
+        CHECK(results[i].offset == first_violation(words[i]));
+    }
+}
+
+
+int main() {
+    test_chunks();
+    test_no_threads();
+    return report("ParallelMatcherTest");
+}
@@ -0,0 +1,81 @@
+/** ***************************************************************************
+ * @file:   RankerTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of Ranker against the accepted strings listed in
+ *  lexicographic order
+ *
+ *****************************************************************************/
+
+#include "Ranker.hpp"
+#include "TestSupport.hpp"
+#include <stdexcept>
+#include <string>
+
+
+/** ***************************************************************************
+ * rank and unrank are inverse bijections onto the positions of the
+ *  accepted strings in the lexicographic list, for n <= 7
+ *
+ *****************************************************************************/
+static void test_small() {
+    DFA<char> dfa;
+    Ranker<char> ranker(dfa);
+    for (int n = 0; n <= 7; n++) {
+        unsigned k = 0;
+        for (const std::string &w : all_strings(n)) {
+            if (!in_language(w))
+                continue;
+            CHECK(ranker.unrank(n, BigUnsigned(k)) == w);
+            CHECK(text(ranker.rank(w)) == std::to_string(k));
+            k++;
+        }
+        CHECK(text(ranker.count(n)) == std::to_string(k));
+        CHECK_THROWS(ranker.unrank(n, BigUnsigned(k)), std::out_of_range);
+    }
+}
+
+
+/** ***************************************************************************
+ * round trips at lengths too long to list, and the strings rank refuses
+ *
+ *****************************************************************************/
+static void test_long() {
+    DFA<char> dfa;
+    Ranker<char> ranker(dfa);
+    TestRandom random(41);
+    for (int n : {40, 300}) {
+        BigUnsigned count = ranker.count(n);
+        BigUnsigned last = count - BigUnsigned(1);
+        std::string first = ranker.unrank(n, BigUnsigned(0));
+        CHECK(first.size() == size_t(n) && in_language(first));
+        CHECK(text(ranker.rank(first)) == "0");
+        CHECK(ranker.rank(ranker.unrank(n, last)) == last);
+
+        for (int i = 0; i < 20; i++) {
+            // a random number below count, digit by digit
+            std::string digits = text(count);
+            for (char &digit : digits)
+                digit = char('0' + random.below(10));
+            BigUnsigned k{std::string_view(digits)};
+            if (!(k < count))
+                continue;
+            std::string w = ranker.unrank(n, k);
+            CHECK(w.size() == size_t(n) && in_language(w));
+            CHECK(ranker.rank(w) == k);
+        }
+    }
+    // later lengths leave the rows of earlier ones intact
+    CHECK(text(ranker.rank("aaabcd")) == "0");
+    CHECK(text(ranker.rank("dddcba")) == text(ranker.count(6) - BigUnsigned(1)));
+
+    CHECK_THROWS(ranker.rank("aaaaaa"), std::invalid_argument);
+    CHECK_THROWS(ranker.rank("abcdax"), std::invalid_argument);
+}
+
+
+int main() {
+    test_small();
+    test_long();
+    return report("RankerTest");
+}
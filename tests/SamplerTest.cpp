@@ -0,0 +1,95 @@
+/** ***************************************************************************
+ * @file:   SamplerTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of Sampler: every sample is an accepted string of length
+ *  n, and for small n every accepted string is drawn about equally often
+ *
+ *****************************************************************************/
+
+#include "Sampler.hpp"
+#include "TestSupport.hpp"
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+
+/** ***************************************************************************
+ * draw 200 samples per accepted string of length 6 and check that they
+ *  are accepted and close to uniform by a chi-square test
+ *
+ *****************************************************************************/
+static void test_uniform(Sampler<char>::Mode mode) {
+    DFA<char> dfa;
+    const int n = 6;
+    const size_t strings = brute_count(n);
+    const size_t count = 200 * strings;
+    Sampler<char> sampler(dfa, n, mode, 40);
+    CHECK(sampler.length() == n);
+
+    std::string out(count * n, '\0');
+    sampler.sample(&out[0], count);
+    std::map<std::string, size_t> seen;
+    for (size_t i = 0; i < count; i++) {
+        std::string w = out.substr(i * n, n);
+        CHECK(in_language(w));
+        seen[w]++;
+    }
+    CHECK(seen.size() == strings);
+
+    // chi-square with strings - 1 degrees of freedom; the bound is about
+    // seven standard deviations above the mean
+    double expected = double(count) / strings, chi = 0;
+    for (auto &entry : seen)
+        chi += (entry.second - expected) * (entry.second - expected) / expected;
+    CHECK(chi < strings + 7 * std::sqrt(2.0 * strings));
+}
+
+
+/** ***************************************************************************
+ * longer strings, odd counts and the lengths that cannot be sampled
+ *
+ *****************************************************************************/
+static void test_lengths() {
+    DFA<char> dfa;
+    for (auto mode : {Sampler<char>::Mode::EXACT, Sampler<char>::Mode::APPROXIMATE}) {
+        for (int n : {0, 1, 7, 50, 300}) {
+            Sampler<char> sampler(dfa, n, mode, n);
+            const size_t count = 67;
+            std::string out(count * n + 1, '#');
+            sampler.sample(&out[0], count);
+            CHECK(out.back() == '#');
+            for (size_t i = 0; i < count; i++)
+                CHECK(in_language(out.substr(i * n, n)));
+        }
+        CHECK_THROWS(Sampler<char>(dfa, -1, mode), std::invalid_argument);
+    }
+
+    // past FIXED_MAX_N exact sampling counts in BigUnsigned
+    for (int n : {DFA<char>::FIXED_MAX_N + 1, 500}) {
+        Sampler<char> beyond(dfa, n, Sampler<char>::Mode::EXACT, n);
+        std::string out(3 * size_t(n), '\0');
+        beyond.sample(&out[0], 3);
+        for (size_t i = 0; i < 3; i++)
+            CHECK(in_language(out.substr(i * n, n)));
+    }
+    Sampler<char> longer(dfa, 1000, Sampler<char>::Mode::APPROXIMATE);
+    std::string w(1000, '\0');
+    longer.sample(&w[0], 1);
+    CHECK(in_language(w));
+
+    // wide symbols
+    std::u32string wide(12, U'\0');
+    DFA<char32_t> wideDfa;
+    Sampler<char32_t>(wideDfa, 12).sample(&wide[0], 1);
+    CHECK(in_language(wide));
+}
+
+
+int main() {
+    test_uniform(Sampler<char>::Mode::EXACT);
+    test_uniform(Sampler<char>::Mode::APPROXIMATE);
+    test_lengths();
+    return report("SamplerTest");
+}
@@ -0,0 +1,166 @@
+/** ***************************************************************************
+ * @file:   StreamMatcherTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of StreamMatcher against the oracle for L
+ *
+ *****************************************************************************/
+
+#include "StreamMatcher.hpp"
+#include "TestSupport.hpp"
+#include <fcntl.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+
+
+/** ***************************************************************************
+ * @return a random string that is in L for long stretches, with a few
+ *  symbols changed, some of them to symbols outside Σ
+ *
+ *****************************************************************************/
+static std::string nearly_valid(TestRandom &random, size_t length) {
+    std::string w;
+    while (w.size() < length)
+        w += "abcdab"[random.below(6)] == 'a' ? "abcd" : "dcba";
+    w.resize(length);
+    for (int k = int(random.below(3)); k > 0 && length > 0; k--)
+        w[random.below(length)] = "abcdx"[random.below(5)];
+    return w;
+}
+
+
+/** ***************************************************************************
+ * whole buffers and pieces, with and without the window kernel
+ *
+ *****************************************************************************/
+static void test_buffers() {
+    DFA<char> dfa;
+    for (bool kernel : {false, true}) {
+        StreamMatcher<char> matcher(dfa, 1 << 16, kernel);
+        for (int n = 0; n <= 7; n++) {
+            for (const std::string &w : all_strings(n, "abcdx")) {
+                MatchResult result = matcher.match(w.data(), w.size());
+                CHECK(result.accepted == in_language(w));
+                CHECK(result.offset == first_violation(w));
+            }
+        }
+
+        TestRandom random(31);
+        for (int i = 0; i < 300; i++) {
+            std::string w = nearly_valid(random, random.below(3000));
+            MatchResult whole = matcher.match(w.data(), w.size());
+            CHECK(whole.accepted == in_language(w));
+            CHECK(whole.offset == first_violation(w));
+
+            // the same input fed in random pieces
+            matcher.reset();
+            for (size_t p = 0; p < w.size(); ) {
+                size_t piece = 1 + random.below(100);
+                if (piece > w.size() - p)
+                    piece = w.size() - p;
+                matcher.feed(w.data() + p, piece);
+                p += piece;
+            }
+            MatchResult pieces = matcher.result();
+            CHECK(pieces.accepted == whole.accepted);
+            CHECK(pieces.offset == whole.offset);
+            CHECK(pieces.state == whole.state);
+        }
+    }
+}
+
+
+/** ***************************************************************************
+ * streams and file descriptors, including read errors
+ *
+ *****************************************************************************/
+static void test_streams() {
+    DFA<char> dfa;
+    StreamMatcher<char> matcher(dfa, 7);
+    TestRandom random(131);
+    for (int i = 0; i < 100; i++) {
+        std::string w = nearly_valid(random, random.below(500));
+        std::istringstream in(w);
+        MatchResult result = matcher.match(in);
+        CHECK(result.accepted == in_language(w));
+        CHECK(result.offset == first_violation(w));
+
+        int pipeEnds[2];
+        CHECK(pipe(pipeEnds) == 0);
+        std::thread writer([&]() {
+            CHECK(write(pipeEnds[1], w.data(), w.size()) == ssize_t(w.size()));
+            close(pipeEnds[1]);
+        });
+        result = matcher.match_fd(pipeEnds[0]);
+        writer.join();
+        close(pipeEnds[0]);
+        CHECK(result.accepted == in_language(w));
+        CHECK(result.offset == first_violation(w));
+    }
+
+    // a failed read is an error, never acceptance
+    int directory = open(".", O_RDONLY);
+    CHECK(directory >= 0);
+    CHECK_THROWS(matcher.match_fd(directory), std::system_error);
+    close(directory);
+
+    std::istringstream broken("abcd");
+    broken.setstate(std::ios::badbit);
+    CHECK_THROWS(matcher.match(broken), std::runtime_error);
+}
+
+
+/** ***************************************************************************
+ * wide symbols split across reads are put back together, and input that
+ *  ends inside a symbol is an error
+ *
+ *****************************************************************************/
+static void test_wide_symbols() {
+    DFA<char32_t> dfa;
+    StreamMatcher<char32_t> matcher(dfa, 3);
+    std::u32string w = U"abcdabcdabcdabcdab";
+    std::string bytes(reinterpret_cast<const char *>(w.data()),
+                      w.size() * sizeof(char32_t));
+
+    // the writer hands over three bytes at a time, so reads end inside
+    // symbols
+    int pipeEnds[2];
+    CHECK(pipe(pipeEnds) == 0);
+    std::thread writer([&]() {
+        for (size_t p = 0; p < bytes.size(); p += 3) {
+            size_t piece = bytes.size() - p < 3 ? bytes.size() - p : 3;
+            CHECK(write(pipeEnds[1], bytes.data() + p, piece) == ssize_t(piece));
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        close(pipeEnds[1]);
+    });
+    MatchResult result = matcher.match_fd(pipeEnds[0]);
+    writer.join();
+    close(pipeEnds[0]);
+    CHECK(result.accepted && result.offset == w.size());
+
+    std::istringstream whole(bytes);
+    result = matcher.match(whole);
+    CHECK(result.accepted && result.offset == w.size());
+
+    std::istringstream truncated(bytes.substr(0, 7));
+    CHECK_THROWS(matcher.match(truncated), std::runtime_error);
+
+    CHECK(pipe(pipeEnds) == 0);
+    CHECK(write(pipeEnds[1], bytes.data(), 7) == 7);
+    close(pipeEnds[1]);
+    CHECK_THROWS(matcher.match_fd(pipeEnds[0]), std::runtime_error);
+    close(pipeEnds[0]);
+}
+
+
+int main() {
+    test_buffers();
+    test_streams();
+    test_wide_symbols();
+    return report("StreamMatcherTest");
+}
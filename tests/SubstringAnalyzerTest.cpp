@@ -0,0 +1,90 @@
+/** ***************************************************************************
+ * @file:   SubstringAnalyzerTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of SubstringAnalyzer against checking every substring
+ *
+ *****************************************************************************/
+
+#include "SubstringAnalyzer.hpp"
+#include "TestSupport.hpp"
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+
+/** ***************************************************************************
+ * random texts against every substring checked with the oracle, fed whole,
+ *  in pieces and from streams
+ *
+ *****************************************************************************/
+static void test_substrings() {
+    DFA<char> dfa;
+    SubstringAnalyzer<char> analyzer(dfa);
+    TestRandom random(37);
+    for (int i = 0; i < 200; i++) {
+        std::string w;
+        size_t length = random.below(80);
+        while (w.size() < length)
+            w += random.below(4) ? random.word(1 + random.below(12), "abcd")
+                                 : std::string(1, "abcdx"[random.below(5)]);
+        w.resize(length);
+
+        uint64_t count = 0, bestOffset = 0, bestLength = 0;
+        for (size_t begin = 0; begin < w.size(); begin++) {
+            for (size_t end = begin + 1; end <= w.size(); end++) {
+                if (!in_language(w.substr(begin, end - begin)))
+                    continue;
+                count++;
+                if (end - begin > bestLength) {
+                    bestLength = end - begin;
+                    bestOffset = begin;
+                }
+            }
+        }
+
+        analyzer.reset();
+        for (size_t p = 0; p < w.size(); ) {
+            size_t piece = 1 + random.below(9);
+            if (piece > w.size() - p)
+                piece = w.size() - p;
+            analyzer.feed(w.data() + p, piece);
+            p += piece;
+        }
+        CHECK(text(analyzer.count()) == std::to_string(count));
+        CHECK(analyzer.longest_length() == bestLength);
+        if (bestLength > 0)
+            CHECK(analyzer.longest_offset() == bestOffset);
+
+        std::istringstream in(w);
+        analyzer.analyze(in, 5);
+        CHECK(text(analyzer.count()) == std::to_string(count));
+        CHECK(analyzer.longest_length() == bestLength);
+    }
+
+    // a text too long to check substring by substring: every substring of
+    // a string in L is in L
+    std::string valid;
+    while (valid.size() < 100000)
+        valid += "abcd";
+    analyzer.reset();
+    analyzer.feed(valid.data(), valid.size());
+    CHECK(text(analyzer.count()) == "5000050000");
+    CHECK(analyzer.longest_offset() == 0 && analyzer.longest_length() == 100000);
+
+    DFA<char32_t> wide;
+    SubstringAnalyzer<char32_t> wideAnalyzer(wide);
+    std::u32string u = U"abcdabcd";
+    std::string bytes(reinterpret_cast<const char *>(u.data()), u.size() * 4);
+    std::istringstream whole(bytes);
+    wideAnalyzer.analyze(whole, 3);
+    CHECK(text(wideAnalyzer.count()) == "36");
+    std::istringstream truncated(bytes.substr(0, 7));
+    CHECK_THROWS(wideAnalyzer.analyze(truncated), std::runtime_error);
+}
+
+
+int main() {
+    test_substrings();
+    return report("SubstringAnalyzerTest");
+}
@@ -0,0 +1,155 @@
+/** ***************************************************************************
+ * @file:   SymbolClassTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of the symbol classes of DFA<char>, DFA<unsigned char>
+ *  and DFA<char32_t> and of the three ways of handling symbols outside Σ
+ *
+ *****************************************************************************/
+
+#include "DFA.hpp"
+#include "BatchMatcher.hpp"
+#include "Ranker.hpp"
+#include "TestSupport.hpp"
+#include <string>
+#include <vector>
+
+
+/** ***************************************************************************
+ * @return true if M, run through its flat table, accepts w
+ *
+ *****************************************************************************/
+template<typename T, typename String>
+static bool run(const DFA<T> &dfa, const String &w) {
+    const int *table = dfa.transition_table();
+    int q = DFA<T>::START;
+    for (auto symbol : w)
+        q = table[q * dfa.table_width() + dfa.symbol_class(T(symbol))];
+    return q != DFA<T>::DEAD;
+}
+
+
+/** ***************************************************************************
+ * @return the pieces of w between the symbols outside Σ
+ *
+ *****************************************************************************/
+static std::vector<std::string> pieces(const std::string &w) {
+    std::vector<std::string> result(1);
+    for (char symbol : w) {
+        if (symbol >= 'a' && symbol <= 'd')
+            result.back() += symbol;
+        else
+            result.emplace_back();
+    }
+    return result;
+}
+
+
+/** ***************************************************************************
+ * every byte and a range of wide code points fall in the right class
+ *
+ *****************************************************************************/
+static void test_classes() {
+    DFA<char> narrow;
+    DFA<unsigned char> bytes;
+    DFA<char32_t> wide;
+    CHECK(narrow.table_width() == 5);
+    for (int c = 0; c < 256; c++) {
+        int expected = c >= 'a' && c <= 'd' ? c - 'a' : 4;
+        CHECK(narrow.symbol_class(char(c)) == expected);
+        CHECK(bytes.symbol_class(static_cast<unsigned char>(c)) == expected);
+        CHECK(wide.symbol_class(char32_t(c)) == expected);
+    }
+    // code points that agree with a letter in their low byte
+    for (char32_t c : {char32_t(0x161), char32_t(0x10064), char32_t(0x1F600),
+                       char32_t(0x10FFFF), char32_t(0xFFFFFFFF)})
+        CHECK(wide.symbol_class(c) == 4);
+    for (int s = 0; s < 4; s++) {
+        CHECK(narrow.letter(s) == 'a' + s);
+        CHECK(bytes.letter(s) == 'a' + s);
+        CHECK(wide.letter(s) == char32_t('a' + s));
+    }
+    CHECK(narrow.letter_mask() == 15);
+}
+
+
+/** ***************************************************************************
+ * REJECT, SKIP and RESET against what each makes of a symbol outside Σ
+ *
+ *****************************************************************************/
+static void test_unknown_symbols() {
+    typedef DFA<char>::UnknownSymbol Unknown;
+    DFA<char> reject(Unknown::REJECT);
+    DFA<char> skip(Unknown::SKIP);
+    DFA<char> reset(Unknown::RESET);
+    DFA<char32_t> wideSkip(DFA<char32_t>::UnknownSymbol::SKIP);
+    CHECK(reject.unknown_symbols() == Unknown::REJECT);
+    CHECK(skip.unknown_symbols() == Unknown::SKIP);
+    CHECK(reset.unknown_symbols() == Unknown::RESET);
+
+    TestRandom random(39);
+    std::vector<std::string> strings;
+    for (int n = 0; n <= 7; n++)
+        for (const std::string &w : all_strings(n, "abcx"))
+            strings.push_back(w);
+    for (int i = 0; i < 500; i++)
+        strings.push_back(random.word(random.below(40), "abcdabcdx"));
+
+    for (const std::string &w : strings) {
+        std::string letters;
+        for (char symbol : w)
+            if (symbol != 'x')
+                letters += symbol;
+        bool everyPiece = true;
+        for (const std::string &piece : pieces(w))
+            everyPiece = everyPiece && in_language(piece);
+
+        CHECK(run(reject, w) == in_language(w));
+        CHECK(run(skip, w) == in_language(letters));
+        CHECK(run(reset, w) == everyPiece);
+
+        std::u32string wideWord;
+        for (char symbol : w)
+            wideWord += symbol == 'x' ? char32_t(0x1F600) : char32_t(symbol);
+        CHECK(run(wideSkip, wideWord) == in_language(letters));
+    }
+}
+
+
+/** ***************************************************************************
+ * the string and view types of unsigned char symbols
+ *
+ *****************************************************************************/
+static void test_byte_strings() {
+    DFA<unsigned char> dfa;
+    DFA<unsigned char>::String w{'a', 'b', 'c', 'd', 'a', 'b', 'x'};
+    CHECK(dfa.contains_every_letter(w));
+    CHECK(!dfa.contains_every_letter(DFA<unsigned char>::String{'a', 'b', 'c'}));
+
+    BatchMatcher<unsigned char> matcher(dfa);
+    std::vector<DFA<unsigned char>::View> views;
+    views.emplace_back(w.data(), 6);
+    views.emplace_back(w);
+    views.emplace_back();
+    uint8_t accepted = 0;
+    matcher.match(views, &accepted);
+    CHECK(accepted == 5);
+
+    Ranker<unsigned char> ranker(dfa);
+    const unsigned count = unsigned(brute_count(6));
+    CHECK(text(ranker.count(6)) == std::to_string(count));
+    for (unsigned k = 0; k < count; k += 97) {
+        DFA<unsigned char>::String u = ranker.unrank(6, BigUnsigned(k));
+        CHECK(u.size() == 6);
+        CHECK(run(dfa, u));
+        CHECK(text(ranker.rank(u)) == std::to_string(k));
+    }
+}
+
+
+int main() {
+    test_classes();
+    test_unknown_symbols();
+    test_byte_strings();
+    return report("SymbolClassTest");
+}
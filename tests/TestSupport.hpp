@@ -0,0 +1,192 @@
+/** ***************************************************************************
+ * @file:   TestSupport.hpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   This file contains the helpers shared by the tests
+ * @remark: Every test is a program that checks one component against a
+ *  brute-force oracle on small inputs and exits with status 1 if any
+ *  check failed. The oracle for L tests the definition directly: every
+ *  substring of length WINDOW holds every letter of Σ, and a symbol
+ *  outside Σ is never accepted.
+ *
+ *****************************************************************************/
+
+#ifndef INC_454_P1_TESTSUPPORT_HPP
+#define INC_454_P1_TESTSUPPORT_HPP
+
+
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// number of failed checks so far
+inline int failures = 0;
+
+// record a failed check without stopping the test, so that one run shows
+// every check that fails
+#define CHECK(condition)                                                    \
+    do {                                                                    \
+        if (!(condition)) {                                                 \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " \
+                      << #condition << std::endl;                           \
+            failures++;                                                     \
+        }                                                                   \
+    } while (false)
+
+// check that a statement throws a given exception type
+#define CHECK_THROWS(statement, exception)                                  \
+    do {                                                                    \
+        bool thrown = false;                                                \
+        try {                                                               \
+            statement;                                                      \
+        }                                                                   \
+        catch (const exception &) {                                         \
+            thrown = true;                                                  \
+        }                                                                   \
+        if (!thrown) {                                                      \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": " << #statement \
+                      << " did not throw " << #exception << std::endl;      \
+            failures++;                                                     \
+        }                                                                   \
+    } while (false)
+
+
+/** ***************************************************************************
+ * @return 0 if every check passed, 1 otherwise, for main to return
+ *
+ *****************************************************************************/
+inline int report(const char *test) {
+    if (failures == 0)
+        std::cout << test << ": all checks passed" << std::endl;
+    else
+        std::cout << test << ": " << failures << " checks failed" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
+
+
+/** ***************************************************************************
+ * @return the decimal text of a number, for any type with operator <<
+ *
+ *****************************************************************************/
+template<typename Number>
+std::string text(const Number &number) {
+    std::ostringstream out;
+    out << number;
+    return out.str();
+}
+
+
+/** ***************************************************************************
+ * the oracle for L
+ * @param  w: the string, over any symbol type
+ * @post   return true if every substring of length 6 of w holds a, b, c
+ *         and d and w holds no other symbol
+ *
+ *****************************************************************************/
+template<typename String>
+bool in_language(const String &w) {
+    for (auto symbol : w)
+        if (symbol < 'a' || symbol > 'd')
+            return false;
+    for (size_t i = 0; i + 6 <= w.size(); i++) {
+        unsigned seen = 0;
+        for (size_t j = i; j < i + 6; j++)
+            seen |= 1u << (w[j] - 'a');
+        if (seen != 15)
+            return false;
+    }
+    return true;
+}
+
+
+/** ***************************************************************************
+ * @return the offset of the first symbol of w after which the prefix read
+ *  so far is not in L, or the length of w if w is in L
+ *
+ *****************************************************************************/
+template<typename String>
+uint64_t first_violation(const String &w) {
+    for (size_t k = 0; k < w.size(); k++) {
+        if (w[k] < 'a' || w[k] > 'd')
+            return k;
+        if (k >= 5) {
+            unsigned seen = 0;
+            for (size_t j = k - 5; j <= k; j++)
+                seen |= 1u << (w[j] - 'a');
+            if (seen != 15)
+                return k;
+        }
+    }
+    return w.size();
+}
+
+
+/** ***************************************************************************
+ * @return every string of length n over the given letters, in
+ *  lexicographic order of the letter positions
+ *
+ *****************************************************************************/
+inline std::vector<std::string> all_strings(int n,
+                                            const std::string &letters = "abcd") {
+    std::vector<std::string> strings{""};
+    for (int k = 0; k < n; k++) {
+        std::vector<std::string> longer;
+        longer.reserve(strings.size() * letters.size());
+        for (const std::string &w : strings)
+            for (char letter : letters)
+                longer.push_back(w + letter);
+        strings.swap(longer);
+    }
+    return strings;
+}
+
+
+/** ***************************************************************************
+ * @return the number of strings of length n in L, by brute force
+ *
+ *****************************************************************************/
+inline uint64_t brute_count(int n) {
+    uint64_t count = 0;
+    for (const std::string &w : all_strings(n))
+        count += in_language(w);
+    return count;
+}
+
+
+/** ***************************************************************************
+ * a small deterministic generator, so that failures can be reproduced
+ *
+ *****************************************************************************/
+class TestRandom {
+public:
+    explicit TestRandom(uint64_t seed) : state(seed) { }
+
+    uint64_t next() {
+        // splitmix64
+        uint64_t z = (state += 0x9E3779B97F4A7C15u);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+        return z ^ (z >> 31);
+    }
+
+    // uniform in 0 .. bound - 1
+    uint64_t below(uint64_t bound) {
+        return next() % bound;
+    }
+
+    // a string of the given length over the given letters
+    std::string word(size_t length, const std::string &letters = "abcd") {
+        std::string w(length, ' ');
+        for (char &symbol : w)
+            symbol = letters[below(letters.size())];
+        return w;
+    }
+
+private:
+    uint64_t state;
+};
+
+
+#endif //INC_454_P1_TESTSUPPORT_HPP
@@ -0,0 +1,94 @@
+/** ***************************************************************************
+ * @file:   TransitionTreeTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of TransitionTable minimization and of TransitionTree
+ *  under random edits, against the oracle for L
+ *
+ *****************************************************************************/
+
+#include "TransitionTree.hpp"
+#include "TransitionTable.hpp"
+#include "TestSupport.hpp"
+#include <string>
+#include <vector>
+
+
+/** ***************************************************************************
+ * @return true if a table accepts a string of symbol classes
+ *
+ *****************************************************************************/
+static bool accepts(const TransitionTable &table, const DFA<char> &dfa,
+                    const std::string &w) {
+    int q = table.start();
+    for (char symbol : w)
+        q = table.next(q, dfa.symbol_class(symbol));
+    return table.accepting(q);
+}
+
+
+/** ***************************************************************************
+ * the minimized table is as small as L allows and accepts the same strings
+ *
+ *****************************************************************************/
+static void test_minimized() {
+    DFA<char> dfa;
+    TransitionTable full(dfa);
+    CHECK(full.states() == DFA<char>::STATES);
+    CHECK(full.width() == 5);
+
+    std::vector<int> stateClass;
+    TransitionTable small = full.minimized(&stateClass);
+    CHECK(small.states() == 328);
+    CHECK(stateClass.size() == size_t(DFA<char>::STATES));
+    CHECK(stateClass[DFA<char>::START] == small.start());
+
+    for (int n = 0; n <= 7; n++) {
+        for (const std::string &w : all_strings(n, "abcx")) {
+            CHECK(accepts(small, dfa, w) == in_language(w));
+            CHECK(accepts(full, dfa, w) == in_language(w));
+        }
+    }
+
+    // minimizing again changes nothing
+    CHECK(small.minimized().states() == small.states());
+}
+
+
+/** ***************************************************************************
+ * whole-text and range queries after every random replacement
+ *
+ *****************************************************************************/
+static void test_edits() {
+    DFA<char> dfa;
+    TestRandom random(38);
+    for (size_t length : {size_t(0), size_t(5), size_t(16), size_t(17), size_t(300)}) {
+        std::string w;
+        while (w.size() < length)
+            w += "abcd";
+        w.resize(length);
+        TransitionTree<char> tree(dfa, w.data(), w.size());
+        CHECK(tree.size() == length);
+        CHECK(tree.accepts() == in_language(w));
+
+        for (int edit = 0; edit < 200 && length > 0; edit++) {
+            size_t position = random.below(length);
+            char symbol = "abcdx"[random.below(edit % 2 ? 4 : 5)];
+            w[position] = symbol;
+            tree.assign(position, symbol);
+            CHECK(tree.at(position) == symbol);
+            CHECK(tree.accepts() == in_language(w));
+
+            size_t begin = random.below(length + 1);
+            size_t end = begin + random.below(length - begin + 1);
+            CHECK(tree.accepts(begin, end) == in_language(w.substr(begin, end - begin)));
+        }
+    }
+}
+
+
+int main() {
+    test_minimized();
+    test_edits();
+    return report("TransitionTreeTest");
+}
@@ -0,0 +1,106 @@
+/** ***************************************************************************
+ * @file:   ViolationReporterTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of ViolationReporter against a window-by-window oracle
+ *
+ *****************************************************************************/
+
+#include "ViolationReporter.hpp"
+#include "TestSupport.hpp"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+/** ***************************************************************************
+ * @return every window of w that lacks a letter or holds a foreign symbol,
+ *  checked one window at a time
+ *
+ *****************************************************************************/
+static std::vector<Violation> oracle(const std::string &w) {
+    std::vector<Violation> found;
+    for (size_t i = 0; i + 6 <= w.size(); i++) {
+        uint32_t missing = 15;
+        for (size_t j = i; j < i + 6; j++) {
+            if (w[j] >= 'a' && w[j] <= 'd')
+                missing &= ~(1u << (w[j] - 'a'));
+            else
+                missing |= 16;
+        }
+        if (missing != 0)
+            found.push_back(Violation{i, missing});
+    }
+    return found;
+}
+
+
+/** ***************************************************************************
+ * @return true if both lists hold the same windows in the same order
+ *
+ *****************************************************************************/
+static bool same(const std::vector<Violation> &a, const std::vector<Violation> &b) {
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); i++)
+        if (a[i].offset != b[i].offset || a[i].missing != b[i].missing)
+            return false;
+    return true;
+}
+
+
+/** ***************************************************************************
+ * random inputs fed in random pieces, through both forms of feed
+ *
+ *****************************************************************************/
+static void test_windows() {
+    DFA<char> dfa;
+    ViolationReporter<char> reporter(dfa);
+    CHECK(reporter.foreign_bit() == 16);
+
+    TestRandom random(34);
+    for (int i = 0; i < 300; i++) {
+        std::string w = random.word(6 + random.below(200),
+                                    i % 3 == 0 ? "abcdx" : "abcd");
+        std::vector<Violation> expected = oracle(w);
+
+        reporter.reset();
+        std::vector<Violation> out(w.size()), buffered;
+        for (size_t p = 0; p < w.size(); ) {
+            size_t piece = 1 + random.below(20);
+            if (piece > w.size() - p)
+                piece = w.size() - p;
+            size_t written = reporter.feed(w.data() + p, piece, out.data());
+            buffered.insert(buffered.end(), out.begin(), out.begin() + written);
+            p += piece;
+        }
+        CHECK(same(buffered, expected));
+
+        reporter.reset();
+        std::vector<Violation> reported;
+        reporter.feed(w.data(), w.size(), [&](const Violation &violation) {
+            reported.push_back(violation);
+        });
+        CHECK(same(reported, expected));
+    }
+
+    DFA<char32_t> wide;
+    ViolationReporter<char32_t> wideReporter(wide);
+    for (int i = 0; i < 50; i++) {
+        std::string w = random.word(6 + random.below(100), "abcdx");
+        std::u32string u(w.begin(), w.end());
+        std::vector<Violation> out(u.size());
+        out.resize(wideReporter.feed(u.data(), u.size(), out.data()));
+        wideReporter.reset();
+        CHECK(same(out, oracle(w)));
+    }
+
+    DFA<char> skipping(DFA<char>::UnknownSymbol::SKIP);
+    CHECK_THROWS(ViolationReporter<char>{skipping}, std::invalid_argument);
+}
+
+
+int main() {
+    test_windows();
+    return report("ViolationReporterTest");
+}
@@ -0,0 +1,93 @@
+/** ***************************************************************************
+ * @file:   WeightedCounterTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of WeightedCounter against sums of weights over the
+ *  accepted strings listed by brute force
+ *
+ *****************************************************************************/
+
+#include "WeightedCounter.hpp"
+#include "TestSupport.hpp"
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+/** ***************************************************************************
+ * @return Σ over accepted strings w of length n of the product of the
+ *  weights of the letters of w
+ *
+ *****************************************************************************/
+template<typename Weight, typename Sum>
+static Sum brute_weight(int n, const std::vector<Weight> &weights) {
+    Sum total = 0;
+    for (const std::string &w : all_strings(n)) {
+        if (!in_language(w))
+            continue;
+        Sum product = 1;
+        for (char symbol : w)
+            product *= weights[symbol - 'a'];
+        total += product;
+    }
+    return total;
+}
+
+
+/** ***************************************************************************
+ * integer weights give exact weighted counts, and weight 1 the plain count
+ *
+ *****************************************************************************/
+static void test_weighted_counts() {
+    DFA<char> dfa;
+    WeightedCounter counter(dfa);
+    CHECK(counter.letters() == 4);
+    const std::vector<std::vector<unsigned>> weightings{
+        {1, 1, 1, 1}, {1, 2, 3, 4}, {0, 1, 1, 1}, {7, 0, 5, 1000}};
+    for (const std::vector<unsigned> &weights : weightings) {
+        for (int n = 0; n <= 7; n++) {
+            uint64_t expected = brute_weight<unsigned, uint64_t>(n, weights);
+            CHECK(text(counter.weighted_count(n, weights)) == std::to_string(expected));
+        }
+    }
+    CHECK(text(counter.weighted_count(9, {1, 1, 1, 1})) == std::to_string(brute_count(9)));
+
+    CHECK_THROWS(counter.weighted_count(-1, {1, 1, 1, 1}), std::invalid_argument);
+    CHECK_THROWS(counter.weighted_count(3, {1, 1, 1}), std::invalid_argument);
+}
+
+
+/** ***************************************************************************
+ * probabilities one at a time and in a batch
+ *
+ *****************************************************************************/
+static void test_probabilities() {
+    DFA<char> dfa;
+    WeightedCounter counter(dfa);
+    const std::vector<std::vector<double>> distributions{
+        {0.25, 0.25, 0.25, 0.25}, {0.1, 0.2, 0.3, 0.4}, {0.5, 0.5, 0, 0},
+        {0.2, 0.2, 0.2, 0.2}};
+    for (int n = 0; n <= 7; n++) {
+        std::vector<double> batch = counter.probabilities(n, distributions);
+        CHECK(batch.size() == distributions.size());
+        for (size_t i = 0; i < distributions.size(); i++) {
+            double expected = brute_weight<double, double>(n, distributions[i]);
+            double single = counter.probability(n, distributions[i]);
+            CHECK(std::fabs(single - expected) < 1e-12);
+            CHECK(std::fabs(batch[i] - expected) < 1e-12);
+        }
+    }
+    CHECK(counter.probabilities(5, {}).empty());
+
+    CHECK_THROWS(counter.probability(-1, distributions[0]), std::invalid_argument);
+    CHECK_THROWS(counter.probability(2, {0.5, 0.5}), std::invalid_argument);
+    CHECK_THROWS(counter.probability(2, {0.5, 0.5, 0.5, -0.5}), std::invalid_argument);
+}
+
+
+int main() {
+    test_weighted_counts();
+    test_probabilities();
+    return report("WeightedCounterTest");
+}
@@ -0,0 +1,87 @@
+/** ***************************************************************************
+ * @file:   WindowScannerTest.cpp
+ * @author: Zach Gassner & Justin Blechel
+ * @date:   19 October 2026
+ * @desc:   tests of WindowScanner against a window-by-window oracle
+ *
+ *****************************************************************************/
+
+#include "WindowScanner.hpp"
+#include "DFA.hpp"
+#include "TestSupport.hpp"
+#include <string>
+#include <vector>
+
+
+/** ***************************************************************************
+ * @return the first offset at which w holds a byte outside Σ or ends a
+ *  window that misses a letter, or the length of w
+ *
+ *****************************************************************************/
+static size_t oracle(const std::string &w, const unsigned char *classes,
+                     unsigned symbols, int window) {
+    for (size_t k = 0; k < w.size(); k++) {
+        if (classes[static_cast<unsigned char>(w[k])] >= symbols)
+            return k;
+        if (k + 1 >= size_t(window)) {
+            unsigned seen = 0;
+            for (size_t j = k + 1 - window; j <= k; j++)
+                seen |= 1u << classes[static_cast<unsigned char>(w[j])];
+            if (seen != (1u << symbols) - 1)
+                return k;
+        }
+    }
+    return w.size();
+}
+
+
+/** ***************************************************************************
+ * the scanner of M and one for another alphabet and window, on inputs
+ *  long enough for the vector kernels and short enough for their tails
+ *
+ *****************************************************************************/
+static void test_scanning() {
+    DFA<char> dfa;
+    WindowScanner scanner(dfa.symbol_classes(), 4, DFA<char>::WINDOW);
+    for (int n = 0; n <= 7; n++) {
+        for (const std::string &w : all_strings(n, "abcx")) {
+            CHECK(scanner.first_violation(reinterpret_cast<const unsigned char *>(w.data()),
+                                          w.size()) == first_violation(w));
+        }
+    }
+
+    // three letters spread over both nibbles, and a window of four
+    std::vector<unsigned char> classes(256, 3);
+    classes['x'] = 0;
+    classes[0xB7] = 1;
+    classes['3'] = 2;
+    const std::string letters = std::string("x3") + char(0xB7);
+    WindowScanner other(classes.data(), 3, 4);
+    CHECK(WindowScanner::supported(3));
+
+    TestRandom random(36);
+    for (int i = 0; i < 400; i++) {
+        size_t length = random.below(700);
+        std::string w, v;
+        while (w.size() < length)
+            w += "abcd";
+        while (v.size() < length)
+            v += letters;
+        w.resize(length);
+        v.resize(length);
+        if (length > 0 && i % 4 != 0) {
+            w[random.below(length)] = "abcdx"[random.below(5)];
+            v[random.below(length)] = (letters + "a")[random.below(4)];
+        }
+        CHECK(scanner.first_violation(reinterpret_cast<const unsigned char *>(w.data()),
+                                      w.size()) == first_violation(w));
+        CHECK(other.first_violation(reinterpret_cast<const unsigned char *>(v.data()),
+                                    v.size()) == oracle(v, classes.data(), 3, 4));
+    }
+}
+
+
+int main() {
+    test_scanning();
+    return report("WindowScannerTest");
+}